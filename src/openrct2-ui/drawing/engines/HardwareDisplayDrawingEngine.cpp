@@ -10,7 +10,9 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
@@ -37,6 +39,9 @@ private:
     SDL_Texture* _scaledScreenTexture = nullptr;
     SDL_PixelFormat* _screenTextureFormat = nullptr;
     uint32_t _paletteHWMapped[256] = { 0 };
+    // The frame as it was last copied to the screen texture, so that only the parts that changed need to be converted
+    std::vector<uint8_t> _copiedBits;
+    bool _copyWholeFrame = true;
 #ifdef __ENABLE_LIGHTFX__
     uint32_t _lightPaletteHWMapped[256] = { 0 };
 #endif
@@ -96,6 +101,7 @@ public:
             SDL_DestroyTexture(_screenTexture);
         }
         SDL_FreeFormat(_screenTextureFormat);
+        _copyWholeFrame = true;
 
         SDL_RendererInfo rendererInfo = {};
         int32_t result = SDL_GetRendererInfo(_sdlRenderer, &rendererInfo);
@@ -161,7 +167,12 @@ public:
         {
             for (int32_t i = 0; i < 256; i++)
             {
-                _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].red, palette[i].green, palette[i].blue);
+                uint32_t colour = SDL_MapRGB(_screenTextureFormat, palette[i].red, palette[i].green, palette[i].blue);
+                if (_paletteHWMapped[i] != colour)
+                {
+                    _paletteHWMapped[i] = colour;
+                    _copyWholeFrame = true;
+                }
             }
 
 #ifdef __ENABLE_LIGHTFX__
@@ -217,11 +228,12 @@ private:
                 lightfx_render_to_texture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            _copyWholeFrame = true;
         }
         else
 #endif
         {
-            CopyBitsToTexture(_screenTexture, _bits, (int32_t)_width, (int32_t)_height, _paletteHWMapped);
+            CopyChangedBitsToTexture();
         }
         if (smoothNN)
         {
@@ -255,6 +267,85 @@ private:
         }
     }
 
+    /**
+     * Converts the parts of the frame that changed since it was last copied to the screen texture. Pixels are also drawn
+     * outside of the dirty blocks (scrolled viewports, rain, chat, FPS counter), so what changed is found by comparing
+     * with the last frame, a band of dirty block rows at a time. The whole frame is converted when the palette or the
+     * texture changes.
+     */
+    void CopyChangedBitsToTexture()
+    {
+        size_t bitsSize = (size_t)_pitch * _height;
+        bool isTexture32 = _screenTextureFormat != nullptr && _screenTextureFormat->BytesPerPixel == 4;
+        if (_copyWholeFrame || !isTexture32 || _copiedBits.size() != bitsSize)
+        {
+            CopyBitsToTexture(_screenTexture, _bits, (int32_t)_width, (int32_t)_height, _paletteHWMapped);
+            _copiedBits.assign(_bits, _bits + bitsSize);
+            _copyWholeFrame = false;
+            return;
+        }
+
+        uint32_t bandHeight = std::max<uint32_t>(_dirtyGrid.BlockHeight, 1);
+        for (uint32_t bandTop = 0; bandTop < _height; bandTop += bandHeight)
+        {
+            uint32_t bandBottom = std::min(bandTop + bandHeight, _height);
+            uint32_t left = _width;
+            uint32_t right = 0;
+            uint32_t top = bandBottom;
+            uint32_t bottom = bandTop;
+            for (uint32_t y = bandTop; y < bandBottom; y++)
+            {
+                const uint8_t* row = _bits + y * _pitch;
+                const uint8_t* copiedRow = _copiedBits.data() + y * _pitch;
+                if (std::memcmp(row, copiedRow, _width) == 0)
+                {
+                    continue;
+                }
+
+                uint32_t rowLeft = 0;
+                while (row[rowLeft] == copiedRow[rowLeft])
+                {
+                    rowLeft++;
+                }
+                uint32_t rowRight = _width;
+                while (row[rowRight - 1] == copiedRow[rowRight - 1])
+                {
+                    rowRight--;
+                }
+                left = std::min(left, rowLeft);
+                right = std::max(right, rowRight);
+                top = std::min(top, y);
+                bottom = y + 1;
+            }
+
+            if (left < right)
+            {
+                CopyRectToTexture(left, top, right - left, bottom - top);
+            }
+        }
+    }
+
+    void CopyRectToTexture(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        SDL_Rect rect = { (int32_t)x, (int32_t)y, (int32_t)width, (int32_t)height };
+        void* pixels;
+        int32_t pitch;
+        if (SDL_LockTexture(_screenTexture, &rect, &pixels, &pitch) == 0)
+        {
+            for (uint32_t yy = 0; yy < height; yy++)
+            {
+                const uint8_t* src = _bits + (y + yy) * _pitch + x;
+                uint32_t* dst = (uint32_t*)((uint8_t*)pixels + yy * pitch);
+                for (uint32_t xx = 0; xx < width; xx++)
+                {
+                    dst[xx] = _paletteHWMapped[src[xx]];
+                }
+                std::memcpy(_copiedBits.data() + (y + yy) * _pitch + x, src, width);
+            }
+            SDL_UnlockTexture(_screenTexture);
+        }
+    }
+
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
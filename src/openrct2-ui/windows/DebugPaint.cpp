@@ -12,6 +12,7 @@
 #include <openrct2-ui/windows/Window.h>
 #include <openrct2/Context.h>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/drawing/FrameProfiler.h>
 #include <openrct2/localisation/Language.h>
 #include <openrct2/localisation/Localisation.h>
 #include <openrct2/localisation/LocalisationService.h>
@@ -30,10 +31,11 @@ enum WINDOW_DEBUG_PAINT_WIDGET_IDX
     WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS,
     WIDX_TOGGLE_SHOW_BOUND_BOXES,
     WIDX_TOGGLE_SHOW_DIRTY_VISUALS,
+    WIDX_TOGGLE_SHOW_FRAME_PROFILER,
 };
 
 constexpr int32_t WINDOW_WIDTH = 200;
-constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 11 + 8;
+constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 15 + 11 + 8;
 
 static rct_widget window_debug_paint_widgets[] = {
     { WWT_FRAME,    0,  0,  WINDOW_WIDTH - 1,   0,              WINDOW_HEIGHT - 1,  STR_NONE,                               STR_NONE },
@@ -42,6 +44,7 @@ static rct_widget window_debug_paint_widgets[] = {
     { WWT_CHECKBOX, 1,  8,  WINDOW_WIDTH - 8,   8 + 15 * 2,     8 + 15 * 2 + 11,    STR_DEBUG_PAINT_SHOW_SEGMENT_HEIGHTS,   STR_NONE },
     { WWT_CHECKBOX, 1,  8,  WINDOW_WIDTH - 8,   8 + 15 * 3,     8 + 15 * 3 + 11,    STR_DEBUG_PAINT_SHOW_BOUND_BOXES,       STR_NONE },
     { WWT_CHECKBOX, 1,  8,  WINDOW_WIDTH - 8,   8 + 15 * 4,     8 + 15 * 4 + 11,    STR_DEBUG_PAINT_SHOW_DIRTY_VISUALS,     STR_NONE },
+    { WWT_CHECKBOX, 1,  8,  WINDOW_WIDTH - 8,   8 + 15 * 5,     8 + 15 * 5 + 11,    STR_DEBUG_PAINT_SHOW_FRAME_PROFILER,    STR_NONE },
     { WIDGETS_END },
 };
 
@@ -96,7 +99,8 @@ rct_window* window_debug_paint_open()
 
     window->widgets = window_debug_paint_widgets;
     window->enabled_widgets = (1 << WIDX_TOGGLE_SHOW_WIDE_PATHS) | (1 << WIDX_TOGGLE_SHOW_BLOCKED_TILES)
-        | (1 << WIDX_TOGGLE_SHOW_BOUND_BOXES) | (1 << WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS) | (1 << WIDX_TOGGLE_SHOW_DIRTY_VISUALS);
+        | (1 << WIDX_TOGGLE_SHOW_BOUND_BOXES) | (1 << WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS) | (1 << WIDX_TOGGLE_SHOW_DIRTY_VISUALS)
+        | (1 << WIDX_TOGGLE_SHOW_FRAME_PROFILER);
     window_init_scroll_widgets(window);
     window_push_others_below(window);
 
@@ -135,6 +139,11 @@ static void window_debug_paint_mouseup([[maybe_unused]] rct_window* w, rct_widge
             gShowDirtyVisuals = !gShowDirtyVisuals;
             gfx_invalidate_screen();
             break;
+
+        case WIDX_TOGGLE_SHOW_FRAME_PROFILER:
+            frame_profiler_set_visible(!frame_profiler_is_visible());
+            gfx_invalidate_screen();
+            break;
     }
 }
 
@@ -149,7 +158,7 @@ static void window_debug_paint_invalidate(rct_window* w)
 
         // Find the width of the longest string
         int16_t newWidth = 0;
-        for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_DIRTY_VISUALS; widgetIndex++)
+        for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_FRAME_PROFILER; widgetIndex++)
         {
             auto stringIdx = w->widgets[widgetIndex].text;
             auto string = ls.GetString(stringIdx);
@@ -170,6 +179,7 @@ static void window_debug_paint_invalidate(rct_window* w)
         w->widgets[WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS].right = newWidth - 8;
         w->widgets[WIDX_TOGGLE_SHOW_BOUND_BOXES].right = newWidth - 8;
         w->widgets[WIDX_TOGGLE_SHOW_DIRTY_VISUALS].right = newWidth - 8;
+        w->widgets[WIDX_TOGGLE_SHOW_FRAME_PROFILER].right = newWidth - 8;
 
         w->Invalidate();
     }
@@ -179,6 +189,7 @@ static void window_debug_paint_invalidate(rct_window* w)
     widget_set_checkbox_value(w, WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS, gShowSupportSegmentHeights);
     widget_set_checkbox_value(w, WIDX_TOGGLE_SHOW_BOUND_BOXES, gPaintBoundingBoxes);
     widget_set_checkbox_value(w, WIDX_TOGGLE_SHOW_DIRTY_VISUALS, gShowDirtyVisuals);
+    widget_set_checkbox_value(w, WIDX_TOGGLE_SHOW_FRAME_PROFILER, frame_profiler_is_visible());
 }
 
 static void window_debug_paint_paint(rct_window* w, rct_drawpixelinfo* dpi)
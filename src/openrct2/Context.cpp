@@ -36,6 +36,7 @@
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
+#include "drawing/FrameProfiler.h"
 #include "drawing/IDrawingEngine.h"
 #include "drawing/LightFX.h"
 #include "interface/Chat.h"
@@ -64,6 +65,7 @@
 #include "world/Park.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <iterator>
@@ -117,6 +119,7 @@ namespace OpenRCT2
         uint32_t _accumulator = 0;
         uint32_t _lastUpdateTime = 0;
         bool _variableFrame = false;
+        GameLoopStats _gameLoopStats;
 
         // If set, will end the OpenRCT2 game loop. Intentially private to this module so that the flag can not be set back to
         // false.
@@ -160,6 +163,7 @@ namespace OpenRCT2
                 _objectManager->UnloadAll();
             }
 
+            scrolling_text_dispose();
             gfx_object_check_all_images_freed();
             gfx_unload_g2();
             gfx_unload_g1();
@@ -238,6 +242,11 @@ namespace OpenRCT2
             return _painter.get();
         }
 
+        const GameLoopStats& GetGameLoopStats() override
+        {
+            return _gameLoopStats;
+        }
+
         int32_t RunOpenRCT2(int argc, const char** argv) override
         {
             if (Initialise())
@@ -883,7 +892,7 @@ namespace OpenRCT2
 
             uint32_t elapsed = currentTick - _lastTick;
             _lastTick = currentTick;
-            _accumulator = std::min(_accumulator + elapsed, static_cast<uint32_t>(GAME_UPDATE_MAX_THRESHOLD));
+            AccumulateElapsedTime(elapsed);
 
             _uiContext->ProcessMessages();
 
@@ -893,17 +902,21 @@ namespace OpenRCT2
                 return;
             }
 
-            while (_accumulator >= GAME_UPDATE_TIME_MS)
+            auto updatesStartTime = std::chrono::high_resolution_clock::now();
+            for (uint32_t numUpdates = 0; ShouldRunUpdate(updatesStartTime, numUpdates); numUpdates++)
             {
-                Update();
-                _accumulator -= GAME_UPDATE_TIME_MS;
+                RunUpdate();
             }
 
             if (!_isWindowMinimised && !gOpenRCT2Headless)
             {
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
-                _drawingEngine->EndDraw();
+                {
+                    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_PRESENT);
+                    _drawingEngine->EndDraw();
+                }
+                frame_profiler_end_frame();
                 _drawingEngine->UpdateWindows();
             }
         }
@@ -922,19 +935,18 @@ namespace OpenRCT2
             uint32_t elapsed = currentTick - _lastTick;
 
             _lastTick = currentTick;
-            _accumulator = std::min(_accumulator + elapsed, static_cast<uint32_t>(GAME_UPDATE_MAX_THRESHOLD));
+            AccumulateElapsedTime(elapsed);
 
             _uiContext->ProcessMessages();
 
-            while (_accumulator >= GAME_UPDATE_TIME_MS)
+            auto updatesStartTime = std::chrono::high_resolution_clock::now();
+            for (uint32_t numUpdates = 0; ShouldRunUpdate(updatesStartTime, numUpdates); numUpdates++)
             {
                 // Get the original position of each sprite
                 if (draw)
                     sprite_position_tween_store_a();
 
-                Update();
-
-                _accumulator -= GAME_UPDATE_TIME_MS;
+                RunUpdate();
 
                 // Get the next position of each sprite
                 if (draw)
@@ -948,7 +960,11 @@ namespace OpenRCT2
 
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
-                _drawingEngine->EndDraw();
+                {
+                    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_PRESENT);
+                    _drawingEngine->EndDraw();
+                }
+                frame_profiler_end_frame();
 
                 sprite_position_tween_restore();
 
@@ -960,6 +976,58 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Adds the real time passed since the last frame. Anything beyond GAME_UPDATE_MAX_THRESHOLD is dropped, the
+         * game then runs slower than real time rather than trying to catch up on it.
+         */
+        void AccumulateElapsedTime(uint32_t elapsed)
+        {
+            uint32_t accumulator = _accumulator + elapsed;
+            if (accumulator > GAME_UPDATE_MAX_THRESHOLD)
+            {
+                _gameLoopStats.DroppedTimeMs += accumulator - GAME_UPDATE_MAX_THRESHOLD;
+                accumulator = GAME_UPDATE_MAX_THRESHOLD;
+            }
+            _accumulator = accumulator;
+        }
+
+        /**
+         * Whether another update is due and fits in this frame. A frame spends at most GAME_UPDATE_MAX_THRESHOLD on
+         * updates, judged by how long updates have been taking. When the next one would not fit, the updates still due
+         * are dropped, otherwise a frame of slow updates would make the next frame run even more of them.
+         */
+        bool ShouldRunUpdate(std::chrono::high_resolution_clock::time_point updatesStartTime, uint32_t numUpdates)
+        {
+            if (_accumulator < GAME_UPDATE_TIME_MS)
+            {
+                return false;
+            }
+
+            auto spentTime = std::chrono::duration<float, std::milli>(
+                std::chrono::high_resolution_clock::now() - updatesStartTime);
+            if (numUpdates > 0 && spentTime.count() + _gameLoopStats.UpdateTimeMs > GAME_UPDATE_MAX_THRESHOLD)
+            {
+                // Keep the part of a tick that is left so that sprites can still be tweened towards the next update
+                uint32_t droppedTime = _accumulator - (_accumulator % GAME_UPDATE_TIME_MS);
+                _gameLoopStats.DroppedTimeMs += droppedTime;
+                _accumulator -= droppedTime;
+                return false;
+            }
+            return true;
+        }
+
+        void RunUpdate()
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            Update();
+            auto updateTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime);
+
+            // Average over the last few updates so that a single slow one does not stop the next frame from catching up
+            _gameLoopStats.UpdateTimeMs += (updateTime.count() - _gameLoopStats.UpdateTimeMs) / 8;
+            _gameLoopStats.Updates++;
+            _accumulator -= GAME_UPDATE_TIME_MS;
+        }
+
         void Update()
         {
             uint32_t currentUpdateTime = platform_get_ticks();
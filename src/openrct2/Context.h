@@ -94,6 +94,19 @@ namespace OpenRCT2
         interface Painter;
     }
 
+    /**
+     * Timings of the game loop, used to see whether updates keep up with real time.
+     */
+    struct GameLoopStats
+    {
+        // Moving average of the real time a single update takes, in milliseconds.
+        float UpdateTimeMs = 0;
+        // Number of updates run since the game loop started.
+        uint64_t Updates = 0;
+        // Real time the game loop did not catch up on and was dropped instead, in milliseconds.
+        uint64_t DroppedTimeMs = 0;
+    };
+
     /**
      * Represents an instance of OpenRCT2 and can be used to get various services.
      */
@@ -115,6 +128,7 @@ namespace OpenRCT2
         virtual int32_t GetDrawingEngineType() abstract;
         virtual Drawing::IDrawingEngine* GetDrawingEngine() abstract;
         virtual Paint::Painter* GetPainter() abstract;
+        virtual const GameLoopStats& GetGameLoopStats() abstract;
 
         virtual int32_t RunOpenRCT2(int argc, const char** argv) abstract;
 
@@ -51,6 +51,7 @@ public:
             case DIRBASE::OPENRCT2:
             case DIRBASE::USER:
             case DIRBASE::CONFIG:
+            case DIRBASE::CACHE:
                 directoryName = DirectoryNamesOpenRCT2[(size_t)did];
                 break;
         }
@@ -222,6 +223,7 @@ const char * PlatformEnvironment::DirectoryNamesOpenRCT2[] =
     "heightmap",            // HEIGHTMAP
     "replay",               // REPLAY
     "desyncs",              // DESYNCS
+    "objectcache",          // CACHE_OBJECT
 };
 
 const char * PlatformEnvironment::FileNames[] =
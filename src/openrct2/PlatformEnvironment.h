@@ -31,23 +31,24 @@ namespace OpenRCT2
 
     enum class DIRID
     {
-        DATA,        // Contains g1.dat, music etc.
-        LANDSCAPE,   // Contains scenario editor landscapes (SC6).
-        LANGUAGE,    // Contains language packs.
-        LOG_CHAT,    // Contains chat logs.
-        LOG_SERVER,  // Contains server logs.
-        NETWORK_KEY, // Contains the user's public and private keys.
-        OBJECT,      // Contains objects.
-        SAVE,        // Contains saved games (SV6).
-        SCENARIO,    // Contains scenarios (SC6).
-        SCREENSHOT,  // Contains screenshots.
-        SEQUENCE,    // Contains title sequences.
-        SHADER,      // Contains OpenGL shaders.
-        THEME,       // Contains interface themes.
-        TRACK,       // Contains track designs.
-        HEIGHTMAP,   // Contains heightmap data.
-        REPLAY,      // Contains recorded replays.
-        LOG_DESYNCS, // Contains desync reports.
+        DATA,         // Contains g1.dat, music etc.
+        LANDSCAPE,    // Contains scenario editor landscapes (SC6).
+        LANGUAGE,     // Contains language packs.
+        LOG_CHAT,     // Contains chat logs.
+        LOG_SERVER,   // Contains server logs.
+        NETWORK_KEY,  // Contains the user's public and private keys.
+        OBJECT,       // Contains objects.
+        SAVE,         // Contains saved games (SV6).
+        SCENARIO,     // Contains scenarios (SC6).
+        SCREENSHOT,   // Contains screenshots.
+        SEQUENCE,     // Contains title sequences.
+        SHADER,       // Contains OpenGL shaders.
+        THEME,        // Contains interface themes.
+        TRACK,        // Contains track designs.
+        HEIGHTMAP,    // Contains heightmap data.
+        REPLAY,       // Contains recorded replays.
+        LOG_DESYNCS,  // Contains desync reports.
+        CACHE_OBJECT, // Contains cached JSON objects and their imported images.
     };
 
     enum class PATHID
@@ -225,6 +225,7 @@ public:
             tileElement->AsTrack()->SetTrackType(TRACK_ELEM_MAZE);
             tileElement->AsTrack()->SetRideIndex(_rideIndex);
             tileElement->AsTrack()->SetMazeEntry(0xFFFF);
+            ride_tile_index_add(_loc, tileElement);
 
             if (flags & GAME_COMMAND_FLAG_GHOST)
             {
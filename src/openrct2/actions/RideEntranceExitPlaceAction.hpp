@@ -200,6 +200,7 @@ public:
         tileElement->AsEntrance()->SetEntranceType(_isExit ? ENTRANCE_TYPE_RIDE_EXIT : ENTRANCE_TYPE_RIDE_ENTRANCE);
         tileElement->AsEntrance()->SetStationIndex(_stationNum);
         tileElement->AsEntrance()->SetRideIndex(_rideIndex);
+        ride_tile_index_add(_loc, tileElement);
 
         if (GetFlags() & GAME_COMMAND_FLAG_GHOST)
         {
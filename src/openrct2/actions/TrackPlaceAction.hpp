@@ -600,6 +600,7 @@ public:
             tileElement->AsTrack()->SetSequenceIndex(trackBlock->index);
             tileElement->AsTrack()->SetRideIndex(_rideIndex);
             tileElement->AsTrack()->SetTrackType(_trackType);
+            ride_tile_index_add(mapLoc, tileElement);
             if (GetFlags() & GAME_COMMAND_FLAG_GHOST)
             {
                 tileElement->SetGhost(true);
@@ -10,18 +10,28 @@
 #include "../interface/Screenshot.h"
 #include "CommandLine.hpp"
 
+static utf8* _tracePath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchGfxOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_tracePath, NAC, "trace", "write the paint times to a Chrome trace event file" },
+    OptionTableEnd
+};
+// clang-format on
+
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::BenchGfxCommands[]{
     // Main commands
-    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx), CommandTableEnd
+    DefineCommand("", "<file> [iterations count]", BenchGfxOptions, HandleBenchGfx), CommandTableEnd
 };
 
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
 {
     const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
     int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
-    int32_t result = cmdline_for_gfxbench(argv, argc);
+    int32_t result = cmdline_for_gfxbench(argv, argc, _tracePath);
     if (result < 0)
     {
         return EXITCODE_FAIL;
@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifndef DISABLE_NETWORK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../actions/ParkSetLoanAction.hpp"
+#    include "../actions/ParkSetResearchFundingAction.hpp"
+#    include "../actions/SetParkEntranceFeeAction.hpp"
+#    include "../config/Config.h"
+#    include "../core/Console.hpp"
+#    include "../management/Finance.h"
+#    include "../management/Research.h"
+#    include "../network/SyntheticClient.h"
+#    include "../network/network.h"
+#    include "../platform/platform.h"
+#    include "../world/Park.h"
+
+#    include <algorithm>
+#    include <chrono>
+#    include <cstdlib>
+#    include <memory>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// The group synthetic clients join as. Group 2 is the stock "User" group, spectators can not run game actions.
+static int32_t _group = 2;
+static int32_t _port = 0;
+static bool _noPacing = false;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchServerOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_port,     NAC, "port",      "port to host the server on (default: configured port + 1)" },
+    { CMDLINE_TYPE_INTEGER, &_group,    NAC, "group",     "group the synthetic clients are assigned to (default: 2)"  },
+    { CMDLINE_TYPE_SWITCH,  &_noPacing, NAC, "no-pacing", "run ticks back to back instead of at the game's tick rate" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchServer(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchServerCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> <clients> <ticks> [<actions_per_second>]", BenchServerOptions, HandleBenchServer),
+    CommandTableEnd
+};
+// clang-format on
+
+struct TickTimings
+{
+    std::vector<double> Durations;
+    uint64_t QueuedPacketsTotal = 0;
+    uint32_t QueuedPacketsMax = 0;
+};
+
+static GameAction::Ptr CreateScriptedAction(uint32_t index)
+{
+    // State preserving actions, the park stays the same no matter how many of them are executed
+    // but every one of them is still validated, queued, executed and broadcast by the server.
+    switch (index % 3)
+    {
+        case 0:
+            return std::make_unique<ParkSetResearchFundingAction>(gResearchPriorities, gResearchFundingLevel);
+        case 1:
+            return std::make_unique<SetParkEntranceFeeAction>(gParkEntranceFee);
+        default:
+            return std::make_unique<ParkSetLoanAction>(gBankLoan);
+    }
+}
+
+static double GetPercentile(std::vector<double> values, double percentile)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, (size_t)(percentile * values.size()));
+    return values[index];
+}
+
+static void PrintReport(
+    const std::vector<std::unique_ptr<SyntheticClient>>& clients, const TickTimings& timings, double elapsedSeconds)
+{
+    double totalDuration = 0;
+    for (auto duration : timings.Durations)
+    {
+        totalDuration += duration;
+    }
+    size_t numTicks = timings.Durations.size();
+    double meanDuration = numTicks == 0 ? 0 : totalDuration / numTicks;
+    double maxDuration = numTicks == 0 ? 0 : *std::max_element(timings.Durations.begin(), timings.Durations.end());
+
+    Console::WriteLine("Server:");
+    Console::WriteLine("  ticks:            %u in %.2f s", (uint32_t)numTicks, elapsedSeconds);
+    Console::WriteLine(
+        "  tick time (ms):   mean %.3f, p99 %.3f, max %.3f", meanDuration, GetPercentile(timings.Durations, 0.99),
+        maxDuration);
+    Console::WriteLine(
+        "  queued packets:   mean %.1f, max %u", numTicks == 0 ? 0.0 : (double)timings.QueuedPacketsTotal / numTicks,
+        timings.QueuedPacketsMax);
+
+    Console::WriteLine("Clients:");
+    Console::WriteLine("  name             join (ms)    recv (KiB/s)    sent (KiB/s)    ticks   gaps  actions  errors");
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        const auto& client = clients[i];
+        const auto& stats = client->GetStats();
+        double received = elapsedSeconds <= 0 ? 0 : stats.bytesReceived[NETWORK_STATISTICS_GROUP_TOTAL] / 1024.0 / elapsedSeconds;
+        double sent = elapsedSeconds <= 0 ? 0 : stats.bytesSent[NETWORK_STATISTICS_GROUP_TOTAL] / 1024.0 / elapsedSeconds;
+        Console::WriteLine(
+            "  %-16s %9u %15.2f %15.2f %8u %6u %8u %7u", client->GetName().c_str(), client->GetJoinTime(), received, sent,
+            client->GetTicksReceived(), client->GetTickGaps(), client->GetActionsSent(),
+            client->GetErrorsReceived());
+        if (client->GetState() == SYNTHETIC_CLIENT_STATE::DISCONNECTED)
+        {
+            const char* reason = client->GetLastError();
+            Console::WriteLine("    disconnected: %s", reason == nullptr ? "(no reason)" : reason);
+        }
+    }
+}
+
+static exitcode_t HandleBenchServer(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 3)
+    {
+        Console::Error::WriteLine("Missing arguments <file> <clients> <ticks>.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+
+    const char* inputPath = argv[0];
+    uint32_t numClients = atol(argv[1]);
+    uint32_t ticks = atol(argv[2]);
+    uint32_t actionsPerSecond = argc >= 4 ? atol(argv[3]) : 0;
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    // Never advertise a benchmark server and stay clear of any real server running on this machine.
+    // The synthetic clients use throw-away keys and must all fit on the server.
+    gConfigNetwork.advertise = false;
+    gConfigNetwork.known_keys_only = false;
+    gConfigNetwork.maxplayers = std::max<int32_t>(gConfigNetwork.maxplayers, numClients + 1);
+    uint16_t port = _port != 0 ? _port : gConfigNetwork.default_port + 1;
+    if (!network_begin_server(port, "127.0.0.1"))
+    {
+        Console::Error::WriteLine("Unable to start server on port %u.", port);
+        return EXITCODE_FAIL;
+    }
+    network_set_default_group((uint8_t)_group);
+
+    Console::WriteLine("Connecting %u synthetic clients to port %u...", numClients, port);
+    std::vector<std::unique_ptr<SyntheticClient>> clients;
+    for (uint32_t i = 0; i < numClients; i++)
+    {
+        auto client = std::make_unique<SyntheticClient>("synthetic" + std::to_string(i + 1));
+        client->Connect("127.0.0.1", port);
+        clients.push_back(std::move(client));
+    }
+
+    Console::WriteLine("Running %u ticks at %u actions per second per client...", ticks, actionsPerSecond);
+    TickTimings timings;
+    timings.Durations.reserve(ticks);
+    uint64_t actionsScheduled = 0;
+    uint32_t actionIndex = 0;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        auto tickStartTime = std::chrono::high_resolution_clock::now();
+
+        // Clients run before the server tick, just like remote clients whose packets are waiting in the socket.
+        for (auto& client : clients)
+        {
+            client->Update();
+        }
+
+        uint64_t actionsDue = (uint64_t)(i + 1) * actionsPerSecond * numClients / GAME_UPDATE_FPS;
+        for (; actionsScheduled < actionsDue; actionsScheduled++)
+        {
+            auto& client = clients[actionsScheduled % numClients];
+            auto action = CreateScriptedAction(actionIndex++);
+            client->SendGameAction(action.get(), gCurrentTicks);
+        }
+
+        auto updateStartTime = std::chrono::high_resolution_clock::now();
+        context->GetGameState()->UpdateLogic();
+        auto updateEndTime = std::chrono::high_resolution_clock::now();
+        timings.Durations.push_back(std::chrono::duration<double, std::milli>(updateEndTime - updateStartTime).count());
+
+        // The tick flushes the outbound queues, so this is how many packets piled up before they were sent.
+        uint32_t queuedPackets = network_get_flushed_packet_count();
+        timings.QueuedPacketsTotal += queuedPackets;
+        timings.QueuedPacketsMax = std::max(timings.QueuedPacketsMax, queuedPackets);
+
+        if (!_noPacing)
+        {
+            auto tickEndTime = std::chrono::high_resolution_clock::now();
+            auto tickDuration = std::chrono::duration_cast<std::chrono::milliseconds>(tickEndTime - tickStartTime).count();
+            if (tickDuration < GAME_UPDATE_TIME_MS)
+            {
+                platform_sleep(GAME_UPDATE_TIME_MS - (uint32_t)tickDuration);
+            }
+        }
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
+
+    PrintReport(clients, timings, elapsedSeconds);
+
+    bool failed = false;
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        if (clients[i]->GetState() != SYNTHETIC_CLIENT_STATE::JOINED)
+        {
+            failed = true;
+        }
+        clients[i]->Disconnect();
+    }
+    network_close();
+    return failed ? EXITCODE_FAIL : EXITCODE_OK;
+}
+
+#endif // DISABLE_NETWORK
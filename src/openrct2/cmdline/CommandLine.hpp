@@ -119,6 +119,9 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand SimulateCommands[];
+#ifndef DISABLE_NETWORK
+    extern const CommandLineCommand BenchServerCommands[];
+#endif
 
     extern const CommandLineExample RootExamples[];
 
@@ -141,6 +141,9 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+#ifndef DISABLE_NETWORK
+    DefineSubCommand("benchserver",     CommandLine::BenchServerCommands      ),
+#endif
     CommandTableEnd
 };
 
@@ -33,6 +33,7 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool multithreading;
+    bool blocked_tile_elements;
     bool minimize_fullscreen_focus_loss;
 
     // Map rendering
@@ -18,9 +18,9 @@
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -34,18 +34,36 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct IndexedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<IndexedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<IndexedFile> files)
             : Stats(stats)
             , Files(files)
         {
         }
     };
 
+    /**
+     * The result of indexing a single file. Files that did not produce an item are kept as well,
+     * so they are not read again until they change.
+     */
+    struct IndexRecord
+    {
+        IndexedFile File;
+        bool HasItem = false;
+        TItem Item;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -54,11 +72,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumRecords = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -94,32 +112,28 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded
+     * from the index and returned, otherwise only the files that were added or changed since the index
+     * was written are read again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
         auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
-        {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
+        auto records = std::get<1>(readIndexResult);
+        if (!std::get<0>(readIndexResult))
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // Index is missing or out of date
+            records = Build(language, scanResult, records);
         }
-        return items;
+        return GetItems(records);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto records = Build(language, scanResult, {});
+        return GetItems(records);
     }
 
 protected:
@@ -143,7 +157,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<IndexedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -156,7 +170,7 @@ private:
                 auto fileInfo = scanner->GetFileInfo();
                 auto path = std::string(scanner->GetPath());
 
-                files.push_back(path);
+                files.push_back({ path, fileInfo->Size, fileInfo->LastModified });
 
                 stats.TotalFiles++;
                 stats.TotalFileSize += fileInfo->Size;
@@ -171,45 +185,88 @@ private:
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<size_t>& indices, size_t rangeStart, size_t rangeEnd,
+        std::vector<IndexRecord>& records, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            // Every task writes to its own set of records, so no locking is required
+            auto& record = records[indices[i]];
 
             if (_log_levels[DIAGNOSTIC_LEVEL_VERBOSE])
             {
                 std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                log_verbose("FileIndex:Indexing '%s'", record.File.Path.c_str());
             }
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
-            {
-                items.push_back(std::get<1>(item));
-            }
+            auto item = Create(language, record.File.Path);
+            record.HasItem = std::get<0>(item);
+            record.Item = std::get<1>(item);
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the records for all scanned files. Records of files that have not changed since the
+     * previous index was written are carried over, all other files are read again.
+     */
+    std::vector<IndexRecord> Build(
+        int32_t language, const ScanResult& scanResult, const std::vector<IndexRecord>& previousRecords) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::unordered_map<std::string, const IndexRecord*> previousRecordMap;
+        for (const auto& record : previousRecords)
+        {
+            previousRecordMap[record.File.Path] = &record;
+        }
+
+        const size_t totalFiles = scanResult.Files.size();
+        std::vector<IndexRecord> records(totalFiles);
+        std::vector<size_t> changedFiles;
+        size_t addedFiles = 0;
+        for (size_t i = 0; i < totalFiles; i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto it = previousRecordMap.find(file.Path);
+            if (it != previousRecordMap.end() && it->second->File.Size == file.Size
+                && it->second->File.LastModified == file.LastModified)
+            {
+                records[i] = *it->second;
+            }
+            else
+            {
+                if (it == previousRecordMap.end())
+                {
+                    addedFiles++;
+                }
+                records[i].File = file;
+                changedFiles.push_back(i);
+            }
+        }
+
+        bool isUpdate = !previousRecords.empty();
+        if (isUpdate)
+        {
+            // Every previous record is either carried over, read again because the file changed, or dropped
+            size_t keptFiles = totalFiles - addedFiles;
+            size_t removedFiles = previousRecordMap.size() - keptFiles;
+            Console::WriteLine(
+                "Updating %s (%zu items added, %zu changed, %zu removed)", _name.c_str(), addedFiles,
+                changedFiles.size() - addedFiles, removedFiles);
+        }
+        else
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalFiles);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = changedFiles.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -226,36 +283,35 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(changedFiles), rangeStart,
+                    rangeStart + stepSize, std::ref(records), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
-
-            for (auto&& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, records);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = (std::chrono::duration<float>)(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        Console::WriteLine(
+            "Finished %s %s in %.2f seconds.", isUpdate ? "updating" : "building", _name.c_str(), duration.count());
 
-        return allItems;
+        return records;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    /**
+     * Reads the records from the index file. Returns whether the index is up to date with the scanned directories
+     * and the records. The records are empty if the index can not be used at all, e.g. when it was written by a
+     * different version or for a different language.
+     */
+    std::tuple<bool, std::vector<IndexRecord>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        bool upToDate = false;
+        std::vector<IndexRecord> records;
         if (File::Exists(_indexPath))
         {
             try
@@ -263,22 +319,32 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = FileStream(_indexPath, FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the records can be used
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    records.resize(header.NumRecords);
+                    for (auto& record : records)
                     {
-                        auto item = Deserialise(&fs);
-                        items.push_back(item);
+                        record.File.Path = fs.ReadStdString();
+                        record.File.Size = fs.ReadValue<uint64_t>();
+                        record.File.LastModified = fs.ReadValue<uint64_t>();
+                        record.HasItem = fs.ReadValue<uint8_t>() != 0;
+                        if (record.HasItem)
+                        {
+                            record.Item = Deserialise(&fs);
+                        }
+                    }
+
+                    // Check if we need to re-scan
+                    upToDate = header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!upToDate)
+                    {
+                        Console::WriteLine("%s out of date", _name.c_str());
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -289,12 +355,14 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                upToDate = false;
+                records.clear();
             }
         }
-        return std::make_tuple(loadedItems, items);
+        return std::make_tuple(upToDate, records);
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<IndexRecord>& records) const
     {
         try
         {
@@ -309,13 +377,20 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = (uint32_t)items.size();
+            header.NumRecords = (uint32_t)records.size();
             fs.WriteValue(header);
 
-            // Write items
-            for (const auto& item : items)
+            // Write records
+            for (const auto& record : records)
             {
-                Serialise(&fs, item);
+                fs.WriteString(record.File.Path);
+                fs.WriteValue<uint64_t>(record.File.Size);
+                fs.WriteValue<uint64_t>(record.File.LastModified);
+                fs.WriteValue<uint8_t>(record.HasItem ? 1 : 0);
+                if (record.HasItem)
+                {
+                    Serialise(&fs, record.Item);
+                }
             }
         }
         catch (const std::exception& e)
@@ -325,6 +400,20 @@ private:
         }
     }
 
+    static std::vector<TItem> GetItems(const std::vector<IndexRecord>& records)
+    {
+        std::vector<TItem> items;
+        items.reserve(records.size());
+        for (const auto& record : records)
+        {
+            if (record.HasItem)
+            {
+                items.push_back(record.Item);
+            }
+        }
+        return items;
+    }
+
     static uint32_t GetPathChecksum(const std::string& path)
     {
         uint32_t hash = 0xD8430DED;
@@ -0,0 +1,112 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+#ifdef _WIN32
+    auto pathW = String::ToWideChar(path);
+    HANDLE file = CreateFileW(
+        pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw IOException("Unable to open " + path);
+    }
+    _fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0 || (uint64_t)fileSize.QuadPart > SIZE_MAX)
+    {
+        Close();
+        throw IOException("Unable to map " + path);
+    }
+    _length = (size_t)fileSize.QuadPart;
+
+    _mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mappingHandle != nullptr)
+    {
+        _data = (const uint8_t*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (_data == nullptr)
+    {
+        Close();
+        throw IOException("Unable to map " + path);
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException("Unable to open " + path);
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size == 0
+        || (uint64_t)fileStat.st_size > SIZE_MAX)
+    {
+        close(fd);
+        throw IOException("Unable to map " + path);
+    }
+    _length = (size_t)fileStat.st_size;
+
+    void* data = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor has been closed.
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        _length = 0;
+        throw IOException("Unable to map " + path);
+    }
+    _data = (const uint8_t*)data;
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+void MemoryMappedFile::Close()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle != nullptr)
+    {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle != nullptr)
+    {
+        CloseHandle(_fileHandle);
+    }
+    _mappingHandle = nullptr;
+    _fileHandle = nullptr;
+#else
+    if (_data != nullptr)
+    {
+        munmap((void*)_data, _length);
+    }
+#endif
+    _data = nullptr;
+    _length = 0;
+}
@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+/**
+ * A read-only view of an entire file mapped into memory. Pages are loaded on first access and,
+ * as the mapping is backed by the file itself, shared between all processes that map the same file.
+ * Throws an IOException if the file can not be opened or mapped.
+ */
+class MemoryMappedFile final
+{
+private:
+    const uint8_t* _data = nullptr;
+    size_t _length = 0;
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+
+public:
+    explicit MemoryMappedFile(const std::string& path);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    const uint8_t* GetData() const
+    {
+        return _data;
+    }
+
+    size_t GetLength() const
+    {
+        return _length;
+    }
+
+private:
+    void Close();
+};
@@ -42,6 +42,67 @@ void mask_avx2(
     }
 }
 
+void blit_transparent_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= width; i += 32)
+    {
+        const __m256i colour = _mm256_lddqu_si256((const __m256i*)(src + i));
+        const __m256i dest = _mm256_lddqu_si256((const __m256i*)(dst + i));
+        const __m256i transparent = _mm256_cmpeq_epi8(colour, zero);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(colour, dest, transparent));
+    }
+    blit_transparent_scalar(width - i, src + i, dst + i);
+}
+
+/**
+ * Looks up the palette entries of 8 pixels at once and returns them in the low 8 bytes. Each pixel gathers the 4 bytes
+ * that end at its entry, so that nothing past the entry is read. The first 3 entries have nothing in front of them,
+ * those pixels are left out of the gather and take their entry from a blend instead.
+ */
+static __m128i gather_palette_entries(const uint8_t* RESTRICT palette, __m256i index)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    __m256i entries = _mm256_blendv_epi8(
+        _mm256_set1_epi32(palette[0] << 24), _mm256_set1_epi32(palette[1] << 24), _mm256_cmpeq_epi32(index, one));
+    entries = _mm256_blendv_epi8(entries, _mm256_set1_epi32(palette[2] << 24), _mm256_cmpeq_epi32(index, two));
+    entries = _mm256_mask_i32gather_epi32(entries, (const int*)(palette - 3), index, _mm256_cmpgt_epi32(index, two), 1);
+
+    // Move the entry of each pixel to the low byte and pack the 8 of them together
+    const __m256i zero = {};
+    const __m256i packed = _mm256_packus_epi16(_mm256_packus_epi32(_mm256_srli_epi32(entries, 24), zero), zero);
+    return _mm_unpacklo_epi32(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+}
+
+void blit_remap_avx2(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette)
+{
+    int32_t i = 0;
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i)));
+        _mm_storel_epi64((__m128i*)(dst + i), gather_palette_entries(palette, index));
+    }
+    blit_remap_scalar(width - i, src + i, dst + i, palette);
+}
+
+void blit_remap_blend_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette)
+{
+    const __m256i firstRow = _mm256_set1_epi32(0x100);
+    const __m256i entryMask = _mm256_set1_epi32(0xFFFF);
+    int32_t i = 0;
+    for (; i + 8 <= width; i += 8)
+    {
+        const __m256i colour = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + i)));
+        const __m256i dest = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(dst + i)));
+        const __m256i index = _mm256_and_si256(
+            _mm256_sub_epi32(_mm256_or_si256(_mm256_slli_epi32(colour, 8), dest), firstRow), entryMask);
+        _mm_storel_epi64((__m128i*)(dst + i), gather_palette_entries(palette, index));
+    }
+    blit_remap_blend_scalar(width - i, src + i, dst + i, palette);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +116,19 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void blit_transparent_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void blit_remap_avx2(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void blit_remap_blend_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -12,14 +12,17 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
 #include "Drawing.h"
+#include "ZoomedSpriteCache.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -40,6 +43,7 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
+    std::unique_ptr<MemoryMappedFile> mapping;
     void* data;
 };
 
@@ -193,6 +197,98 @@ void mask_scalar(
     }
 }
 
+void blit_transparent_scalar(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    for (int32_t i = 0; i < width; i++)
+    {
+        if (src[i] != 0)
+        {
+            dst[i] = src[i];
+        }
+    }
+}
+
+void blit_sample_scalar(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    if (zoomLevel == 0)
+    {
+        if (srcWidth > 0)
+        {
+            std::memcpy(dst, src, srcWidth);
+        }
+        return;
+    }
+
+    int32_t zoomAmount = 1 << zoomLevel;
+    for (int32_t i = 0; i < srcWidth; i += zoomAmount)
+    {
+        *dst++ = src[i];
+    }
+}
+
+void blit_remap_scalar(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette)
+{
+    for (int32_t i = 0; i < width; i++)
+    {
+        dst[i] = palette[src[i]];
+    }
+}
+
+void blit_remap_blend_scalar(
+    int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette)
+{
+    for (int32_t i = 0; i < width; i++)
+    {
+        uint16_t color = ((src[i] << 8) | dst[i]) - 0x100;
+        dst[i] = palette[color];
+    }
+}
+
+/**
+ * Reads the element data of a graphics file and points the element offsets at it. The data is mapped
+ * straight from the file if possible, so it is shared between processes and only paged in once drawn.
+ * Otherwise it is read from the stream onto the heap.
+ */
+static void gfx_load_gx_data(rct_gx& gx, const std::string& path, IStream& stream)
+{
+    const uint8_t* data = nullptr;
+    uint64_t dataOffset = stream.GetPosition();
+    try
+    {
+        auto mapping = std::make_unique<MemoryMappedFile>(path);
+        if (mapping->GetLength() >= dataOffset + gx.header.total_size)
+        {
+            data = mapping->GetData() + dataOffset;
+            gx.mapping = std::move(mapping);
+        }
+    }
+    catch (const IOException&)
+    {
+        log_verbose("Unable to map %s, reading it instead.", path.c_str());
+    }
+
+    if (data == nullptr)
+    {
+        gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+        data = (const uint8_t*)gx.data;
+    }
+
+    // Fix entry data offsets, sprite data is never written to so the mapping can be read-only.
+    for (auto& element : gx.elements)
+    {
+        element.offset += (uintptr_t)data;
+    }
+}
+
+static void gfx_unload_gx(rct_gx& gx)
+{
+    zoomed_sprite_cache_clear();
+    gx.mapping = nullptr;
+    SafeFree(gx.data);
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+}
+
 static std::string gfx_get_csg_header_path()
 {
     auto path = Path::ResolveCasing(Path::Combine(gConfigGeneral.rct1_path, "Data", "csg1i.dat"));
@@ -203,7 +299,7 @@ static std::string gfx_get_csg_header_path()
     return path;
 }
 
-static std::string gfx_get_csg_data_path()
+std::string gfx_get_csg_data_path()
 {
     // csg1.1 and csg1.dat are the same file.
     // In the CD version, it's called csg1.1 on the CD and csg1.dat on the disk.
@@ -253,13 +349,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g1.header.num_entries; i++)
-        {
-            _g1.elements[i].offset += (uintptr_t)_g1.data;
-        }
+        gfx_load_gx_data(_g1, path, fs);
         return true;
     }
     catch (const std::exception&)
@@ -279,23 +369,17 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    SafeFree(_g1.data);
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    gfx_unload_gx(_g1);
 }
 
 void gfx_unload_g2()
 {
-    SafeFree(_g2.data);
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    gfx_unload_gx(_g2);
 }
 
 void gfx_unload_csg()
 {
-    SafeFree(_csg.data);
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    gfx_unload_gx(_csg);
 }
 
 bool gfx_load_g2()
@@ -316,13 +400,7 @@ bool gfx_load_g2()
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g2.header.num_entries; i++)
-        {
-            _g2.elements[i].offset += (uintptr_t)_g2.data;
-        }
+        gfx_load_gx_data(_g2, path, fs);
         return true;
     }
     catch (const std::exception&)
@@ -373,12 +451,10 @@ bool gfx_load_csg()
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        gfx_load_gx_data(_csg, pathDataPath, fileData);
 
-        // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += (uintptr_t)_csg.data;
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -474,22 +550,24 @@ void FASTCALL gfx_bmp_sprite_to_buffer(
     { // Not tested
         for (; height > 0; height -= zoom_amount)
         {
-            uint8_t* next_source_pointer = source_pointer + source_line_width;
-            uint8_t* next_dest_pointer = dest_pointer + dest_line_width;
-
-            for (int32_t no_pixels = width; no_pixels > 0;
-                 no_pixels -= zoom_amount, dest_pointer++, source_pointer += zoom_amount)
-            {
-                *dest_pointer = *source_pointer;
-            }
-
-            dest_pointer = next_dest_pointer;
-            source_pointer = next_source_pointer;
+            blit_sample_fn(width, zoom_level, source_pointer, dest_pointer);
+            dest_pointer += dest_line_width;
+            source_pointer += source_line_width;
         }
         return;
     }
 
     // Basic bitmap with no draw pixels
+    if (zoom_level == 0)
+    {
+        for (; height > 0; height--)
+        {
+            blit_transparent_fn(width, source_pointer, dest_pointer);
+            dest_pointer += dest_line_width;
+            source_pointer += source_line_width;
+        }
+        return;
+    }
     for (; height > 0; height -= zoom_amount)
     {
         uint8_t* next_source_pointer = source_pointer + source_line_width;
@@ -728,6 +806,19 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
 
     if (g1->flags & G1_FLAG_RLE_COMPRESSION)
     {
+        // Zoomed out sprites are drawn from a copy that only has the columns that are drawn at this zoom level
+        if (zoom_level != 0 && (source_start_x & ~zoom_mask) == 0)
+        {
+            const auto* zoomedSprite = zoomed_sprite_cache_get(imageId.GetIndex(), g1, zoom_level);
+            if (zoomedSprite != nullptr)
+            {
+                gfx_zoomed_sprite_to_buffer(
+                    *zoomedSprite, dest_pointer, palette_pointer, dpi, imageId, source_start_y, height, source_start_x,
+                    width);
+                return;
+            }
+        }
+
         // We have to use a different method to move the source pointer for
         // rle encoded sprites so that will be handled within this function
         gfx_rle_sprite_to_buffer(
@@ -516,6 +516,43 @@ void mask_init()
     }
 }
 
+void (*blit_transparent_fn)(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst) = nullptr;
+void (*blit_sample_fn)(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst) = nullptr;
+void (*blit_remap_fn)(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette) = nullptr;
+void (*blit_remap_blend_fn)(
+    int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette)
+    = nullptr;
+
+void blit_init()
+{
+    // There is no AVX2 version of blit_sample, the SSE4.1 one is used on CPUs with AVX2 as well. The palette lookups of
+    // blit_remap and blit_remap_blend need the AVX2 gather, they stay scalar on CPUs with only SSE4.1.
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 blit functions");
+        blit_transparent_fn = blit_transparent_avx2;
+        blit_sample_fn = blit_sample_sse4_1;
+        blit_remap_fn = blit_remap_avx2;
+        blit_remap_blend_fn = blit_remap_blend_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 blit functions");
+        blit_transparent_fn = blit_transparent_sse4_1;
+        blit_sample_fn = blit_sample_sse4_1;
+        blit_remap_fn = blit_remap_scalar;
+        blit_remap_blend_fn = blit_remap_blend_scalar;
+    }
+    else
+    {
+        log_verbose("registering scalar blit functions");
+        blit_transparent_fn = blit_transparent_scalar;
+        blit_sample_fn = blit_sample_scalar;
+        blit_remap_fn = blit_remap_scalar;
+        blit_remap_blend_fn = blit_remap_blend_scalar;
+    }
+}
+
 void gfx_draw_pixel(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t colour)
 {
     gfx_fill_rect(dpi, x, y, x, y, colour);
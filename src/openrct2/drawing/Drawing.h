@@ -13,6 +13,8 @@
 #include "../common.h"
 #include "../interface/Colour.h"
 
+#include <string>
+
 namespace OpenRCT2
 {
     interface IPlatformEnvironment;
@@ -23,6 +25,8 @@ namespace OpenRCT2::Drawing
     interface IDrawingEngine;
 }
 
+struct ZoomedSprite;
+
 struct rct_g1_element
 {
     uint8_t* offset;       // 0x00
@@ -483,6 +487,7 @@ const rct_g1_element* gfx_get_g1_element(ImageId imageId);
 const rct_g1_element* gfx_get_g1_element(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
 bool is_csg_loaded();
+std::string gfx_get_csg_data_path();
 uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
 void gfx_object_check_all_images_freed();
@@ -495,6 +500,10 @@ void FASTCALL gfx_rle_sprite_to_buffer(
     const uint8_t* RESTRICT source_bits_pointer, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
     const rct_drawpixelinfo* RESTRICT dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
     int32_t width);
+void FASTCALL gfx_zoomed_sprite_to_buffer(
+    const ZoomedSprite& sprite, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
+    const rct_drawpixelinfo* RESTRICT dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
+    int32_t width);
 void FASTCALL gfx_draw_sprite(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour);
 void FASTCALL gfx_draw_glpyh(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette);
 void FASTCALL gfx_draw_sprite_raw_masked(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
@@ -553,6 +562,7 @@ void ttf_draw_string(rct_drawpixelinfo* dpi, const_utf8string text, int32_t colo
 // scrolling text
 void scrolling_text_initialise_bitmaps();
 void scrolling_text_invalidate();
+void scrolling_text_dispose();
 int32_t scrolling_text_setup(
     struct paint_session* session, rct_string_id stringId, uint16_t scroll, uint16_t scrollingMode, colour_t colour);
 
@@ -574,6 +584,28 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Copies width pixels from src to dst, except for the pixels that are 0 (transparent) in src.
+void blit_transparent_scalar(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+void blit_transparent_sse4_1(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+void blit_transparent_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+// Copies every (1 << zoomLevel)th pixel of the first srcWidth pixels of src to dst.
+void blit_sample_scalar(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+void blit_sample_sse4_1(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+// Writes the palette entry of each of the width pixels of src to dst, src may be the same as dst.
+void blit_remap_scalar(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette);
+void blit_remap_avx2(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette);
+// Blends width pixels of src onto dst through the 64K entry table of a transparent palette.
+void blit_remap_blend_scalar(
+    int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette);
+void blit_remap_blend_avx2(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette);
+void blit_init();
+
+extern void (*blit_transparent_fn)(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+extern void (*blit_sample_fn)(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst);
+extern void (*blit_remap_fn)(int32_t width, const uint8_t* src, uint8_t* dst, const uint8_t* RESTRICT palette);
+extern void (*blit_remap_blend_fn)(
+    int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette);
+
 #include "NewDrawing.h"
 
 #endif
@@ -10,7 +10,9 @@
 #pragma warning(disable : 4127) // conditional expression is constant
 
 #include "Drawing.h"
+#include "ZoomedSpriteCache.h"
 
+#include <algorithm>
 #include <cstring>
 
 template<int32_t image_type, int32_t zoom_level>
@@ -98,26 +100,43 @@ static void FASTCALL DrawRLESprite2(
             // If the image type is not a basic one we require to mix the pixels
             if (image_type & IMAGE_TYPE_REMAP) // palette controlled images
             {
-                for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
+                if (zoom_level == 0)
                 {
                     if (image_type & IMAGE_TYPE_TRANSPARENT)
-                    {
-                        uint16_t color = ((*copySrc << 8) | *copyDest) - 0x100;
-                        *copyDest = palette_pointer[color];
-                    }
+                        blit_remap_blend_fn(numPixels, copySrc, copyDest, palette_pointer);
                     else
+                        blit_remap_fn(numPixels, copySrc, copyDest, palette_pointer);
+                }
+                else
+                {
+                    for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
                     {
-                        *copyDest = palette_pointer[*copySrc];
+                        if (image_type & IMAGE_TYPE_TRANSPARENT)
+                        {
+                            uint16_t color = ((*copySrc << 8) | *copyDest) - 0x100;
+                            *copyDest = palette_pointer[color];
+                        }
+                        else
+                        {
+                            *copyDest = palette_pointer[*copySrc];
+                        }
                     }
                 }
             }
             else if (image_type & IMAGE_TYPE_TRANSPARENT) // single alpha blended color (used for glass)
             {
-                for (int j = 0; j < numPixels; j += zoom_amount, copyDest++)
+                if (zoom_level == 0)
+                {
+                    blit_remap_fn(numPixels, copyDest, copyDest, palette_pointer);
+                }
+                else
                 {
-                    uint8_t pixel = *copyDest;
-                    pixel = palette_pointer[pixel];
-                    *copyDest = pixel;
+                    for (int j = 0; j < numPixels; j += zoom_amount, copyDest++)
+                    {
+                        uint8_t pixel = *copyDest;
+                        pixel = palette_pointer[pixel];
+                        *copyDest = pixel;
+                    }
                 }
             }
             else // standard opaque image
@@ -130,8 +149,7 @@ static void FASTCALL DrawRLESprite2(
                 }
                 else
                 {
-                    for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
-                        *copyDest = *copySrc;
+                    blit_sample_fn(numPixels, zoom_level, copySrc, copyDest);
                 }
             }
         }
@@ -203,3 +221,119 @@ void FASTCALL gfx_rle_sprite_to_buffer(
         DrawRLESpriteHelper1(IMAGE_TYPE_DEFAULT);
     }
 }
+
+static uint16_t ReadZoomedSpriteUInt16(const uint8_t*& data)
+{
+    uint16_t value = data[0] | (data[1] << 8);
+    data += 2;
+    return value;
+}
+
+/**
+ * Draws the same pixels as DrawRLESprite2 at a zoom level above 0, but from a sprite that has already been decoded
+ * and had the columns that are not drawn at this zoom level removed. source_x_start must be a multiple of the zoom
+ * amount, which it is for all dpis that are aligned to the zoom level.
+ */
+template<int32_t image_type>
+static void FASTCALL DrawZoomedSprite(
+    const ZoomedSprite& sprite, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
+    const rct_drawpixelinfo* RESTRICT dpi, int32_t source_y_start, int32_t height, int32_t source_x_start, int32_t width)
+{
+    int32_t zoom_level = dpi->zoom_level;
+    int32_t zoom_amount = 1 << zoom_level;
+    int32_t line_width = (dpi->width >> zoom_level) + dpi->pitch;
+
+    if (source_y_start < 0)
+    {
+        source_y_start += zoom_amount;
+        height -= zoom_amount;
+        dest_bits_pointer += line_width;
+    }
+
+    // The range of zoomed columns that are visible
+    int32_t firstColumn = source_x_start >> zoom_level;
+    int32_t endColumn = (source_x_start + width + zoom_amount - 1) >> zoom_level;
+
+    for (int32_t i = 0; i < height; i += zoom_amount)
+    {
+        int32_t y = source_y_start + i;
+        if (y >= sprite.Height)
+        {
+            break;
+        }
+
+        const uint8_t* rowData = sprite.Data.data() + sprite.RowOffsets[y];
+        uint8_t* loop_dest_pointer = dest_bits_pointer + line_width * (i >> zoom_level);
+        uint16_t numRuns = ReadZoomedSpriteUInt16(rowData);
+        for (uint16_t run = 0; run < numRuns; run++)
+        {
+            int32_t runX = ReadZoomedSpriteUInt16(rowData);
+            int32_t runLength = ReadZoomedSpriteUInt16(rowData);
+            const uint8_t* runPixels = rowData;
+            rowData += runLength;
+
+            int32_t startX = std::max(runX, firstColumn);
+            int32_t endX = std::min(runX + runLength, endColumn);
+            if (startX >= endX)
+            {
+                continue;
+            }
+
+            const uint8_t* copySrc = runPixels + (startX - runX);
+            uint8_t* copyDest = loop_dest_pointer + (startX - firstColumn);
+            int32_t numPixels = endX - startX;
+            if (image_type & IMAGE_TYPE_REMAP)
+            {
+                if (image_type & IMAGE_TYPE_TRANSPARENT)
+                {
+                    blit_remap_blend_fn(numPixels, copySrc, copyDest, palette_pointer);
+                }
+                else
+                {
+                    blit_remap_fn(numPixels, copySrc, copyDest, palette_pointer);
+                }
+            }
+            else if (image_type & IMAGE_TYPE_TRANSPARENT)
+            {
+                blit_remap_fn(numPixels, copyDest, copyDest, palette_pointer);
+            }
+            else
+            {
+                std::memcpy(copyDest, copySrc, numPixels);
+            }
+        }
+    }
+}
+
+#define DrawZoomedSpriteHelper(image_type)                                                                                     \
+    DrawZoomedSprite<image_type>(                                                                                              \
+        sprite, dest_bits_pointer, palette_pointer, dpi, source_y_start, height, source_x_start, width)
+
+/**
+ * Transfers a sprite from the zoomed sprite cache onto a zoomed out buffer, see gfx_rle_sprite_to_buffer.
+ */
+void FASTCALL gfx_zoomed_sprite_to_buffer(
+    const ZoomedSprite& sprite, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
+    const rct_drawpixelinfo* RESTRICT dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
+    int32_t width)
+{
+    if (imageId.HasPrimary())
+    {
+        if (imageId.IsBlended())
+        {
+            DrawZoomedSpriteHelper(IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT);
+        }
+        else
+        {
+            DrawZoomedSpriteHelper(IMAGE_TYPE_REMAP);
+        }
+    }
+    else if (imageId.IsBlended())
+    {
+        DrawZoomedSpriteHelper(IMAGE_TYPE_TRANSPARENT);
+    }
+    else
+    {
+        DrawZoomedSpriteHelper(IMAGE_TYPE_DEFAULT);
+    }
+}
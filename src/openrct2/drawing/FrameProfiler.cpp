@@ -0,0 +1,227 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FrameProfiler.h"
+
+#include "../Diagnostic.h"
+#include "../core/File.h"
+#include "../localisation/StringIds.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// The number of frames the average and maximum are taken over.
+constexpr size_t FRAME_PROFILER_HISTORY_SIZE = 128;
+
+struct FrameProfilerTraceEvent
+{
+    FRAME_PROFILER_SECTION Section;
+    int32_t ThreadId;
+    FrameProfilerClock::time_point Start;
+    FrameProfilerClock::time_point End;
+};
+
+static constexpr const char* SectionNames[FRAME_PROFILER_SECTION_COUNT] = {
+    "viewport_fill_column", "paint_session_arrange", "viewport_paint_column",
+    "window_draw_all",      "DrawAllDirtyBlocks",    "Present",
+};
+
+static constexpr const rct_string_id SectionStringIds[FRAME_PROFILER_SECTION_COUNT] = {
+    STR_FRAME_PROFILER_SECTION_FILL_COLUMN,       STR_FRAME_PROFILER_SECTION_ARRANGE,
+    STR_FRAME_PROFILER_SECTION_PAINT_COLUMN,      STR_FRAME_PROFILER_SECTION_DRAW_WINDOWS,
+    STR_FRAME_PROFILER_SECTION_DRAW_DIRTY_BLOCKS, STR_FRAME_PROFILER_SECTION_PRESENT,
+};
+
+static std::atomic<bool> _enabled{ false };
+static std::atomic<bool> _tracing{ false };
+static bool _visible = false;
+static std::array<std::atomic<int64_t>, FRAME_PROFILER_SECTION_COUNT> _currentFrame{};
+static std::array<std::array<int64_t, FRAME_PROFILER_SECTION_COUNT>, FRAME_PROFILER_HISTORY_SIZE> _history{};
+static size_t _historyIndex = 0;
+static size_t _historyCount = 0;
+
+static std::mutex _traceMutex;
+static std::vector<FrameProfilerTraceEvent> _traceEvents;
+static FrameProfilerClock::time_point _traceStart;
+static std::atomic<int32_t> _nextThreadId{ 1 };
+
+static thread_local std::array<uint8_t, FRAME_PROFILER_SECTION_COUNT> _depth{};
+static thread_local int32_t _threadId = 0;
+
+bool frame_profiler_is_enabled()
+{
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+bool frame_profiler_is_visible()
+{
+    return _visible;
+}
+
+void frame_profiler_set_visible(bool visible)
+{
+    if (visible && !_visible)
+    {
+        _historyIndex = 0;
+        _historyCount = 0;
+        for (auto& total : _currentFrame)
+        {
+            total = 0;
+        }
+    }
+    _visible = visible;
+    _enabled = _visible || _tracing;
+}
+
+void frame_profiler_add(
+    FRAME_PROFILER_SECTION section, FrameProfilerClock::time_point start, FrameProfilerClock::time_point end)
+{
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    _currentFrame[section].fetch_add(duration, std::memory_order_relaxed);
+
+    if (_tracing.load(std::memory_order_relaxed))
+    {
+        if (_threadId == 0)
+        {
+            _threadId = _nextThreadId++;
+        }
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        _traceEvents.push_back({ section, _threadId, start, end });
+    }
+}
+
+void frame_profiler_end_frame()
+{
+    if (!frame_profiler_is_enabled())
+    {
+        return;
+    }
+
+    auto& frame = _history[_historyIndex];
+    for (size_t i = 0; i < FRAME_PROFILER_SECTION_COUNT; i++)
+    {
+        frame[i] = _currentFrame[i].exchange(0, std::memory_order_relaxed);
+    }
+    _historyIndex = (_historyIndex + 1) % FRAME_PROFILER_HISTORY_SIZE;
+    _historyCount = std::min(_historyCount + 1, FRAME_PROFILER_HISTORY_SIZE);
+}
+
+const char* frame_profiler_get_section_name(FRAME_PROFILER_SECTION section)
+{
+    return SectionNames[section];
+}
+
+rct_string_id frame_profiler_get_section_string_id(FRAME_PROFILER_SECTION section)
+{
+    return SectionStringIds[section];
+}
+
+FrameProfilerStats frame_profiler_get_stats(FRAME_PROFILER_SECTION section)
+{
+    FrameProfilerStats stats{};
+    if (_historyCount == 0)
+    {
+        return stats;
+    }
+
+    int64_t total = 0;
+    int64_t max = 0;
+    for (size_t i = 0; i < _historyCount; i++)
+    {
+        auto duration = _history[i][section];
+        total += duration;
+        max = std::max(max, duration);
+    }
+    size_t lastIndex = (_historyIndex + FRAME_PROFILER_HISTORY_SIZE - 1) % FRAME_PROFILER_HISTORY_SIZE;
+    stats.Last = _history[lastIndex][section] / 1000000.0;
+    stats.Average = total / (_historyCount * 1000000.0);
+    stats.Max = max / 1000000.0;
+    return stats;
+}
+
+void frame_profiler_start_trace()
+{
+    {
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        _traceEvents.clear();
+        _traceStart = FrameProfilerClock::now();
+    }
+    _tracing = true;
+    _enabled = true;
+}
+
+/**
+ * Writes the events recorded since frame_profiler_start_trace and stops recording. Returns false if the file could not
+ * be written.
+ */
+bool frame_profiler_write_trace(const std::string& path)
+{
+    _tracing = false;
+    _enabled = _visible;
+
+    std::string json = "{\"traceEvents\":[";
+    {
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        char buffer[256];
+        for (size_t i = 0; i < _traceEvents.size(); i++)
+        {
+            const auto& traceEvent = _traceEvents[i];
+            auto start = std::chrono::duration<double, std::micro>(traceEvent.Start - _traceStart).count();
+            auto duration = std::chrono::duration<double, std::micro>(traceEvent.End - traceEvent.Start).count();
+            snprintf(
+                buffer, sizeof(buffer),
+                "%s\n{\"name\":\"%s\",\"cat\":\"paint\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                i == 0 ? "" : ",", SectionNames[traceEvent.Section], start, duration, traceEvent.ThreadId);
+            json += buffer;
+        }
+        _traceEvents.clear();
+        _traceEvents.shrink_to_fit();
+    }
+    json += "\n]}\n";
+
+    try
+    {
+        File::WriteAllBytes(path, json.data(), json.size());
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write trace to '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+FrameProfilerScope::FrameProfilerScope(FRAME_PROFILER_SECTION section)
+    : _section(section)
+{
+    if (frame_profiler_is_enabled())
+    {
+        _entered = true;
+        if (_depth[section]++ == 0)
+        {
+            _active = true;
+            _start = FrameProfilerClock::now();
+        }
+    }
+}
+
+FrameProfilerScope::~FrameProfilerScope()
+{
+    if (_active)
+    {
+        frame_profiler_add(_section, _start, FrameProfilerClock::now());
+    }
+    if (_entered)
+    {
+        _depth[_section]--;
+    }
+}
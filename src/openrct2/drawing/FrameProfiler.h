@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <chrono>
+#include <string>
+
+/**
+ * Measures how long the steps of drawing a frame take. The times of a section are summed over all the threads it ran
+ * on, so the columns painted on the paint job threads can add up to more than the frame took. Sections that are
+ * entered again while they are running, e.g. windows drawn from within window_draw_all, are only counted once.
+ */
+enum FRAME_PROFILER_SECTION : uint8_t
+{
+    FRAME_PROFILER_SECTION_FILL_COLUMN,
+    FRAME_PROFILER_SECTION_ARRANGE,
+    FRAME_PROFILER_SECTION_PAINT_COLUMN,
+    FRAME_PROFILER_SECTION_DRAW_WINDOWS,
+    FRAME_PROFILER_SECTION_DRAW_DIRTY_BLOCKS,
+    FRAME_PROFILER_SECTION_PRESENT,
+    FRAME_PROFILER_SECTION_COUNT,
+};
+
+struct FrameProfilerStats
+{
+    // All in milliseconds.
+    double Last;
+    double Average;
+    double Max;
+};
+
+using FrameProfilerClock = std::chrono::steady_clock;
+
+bool frame_profiler_is_enabled();
+/** Whether the times are shown over the game, the sections are measured while they are shown or traced. */
+bool frame_profiler_is_visible();
+void frame_profiler_set_visible(bool visible);
+void frame_profiler_add(
+    FRAME_PROFILER_SECTION section, FrameProfilerClock::time_point start, FrameProfilerClock::time_point end);
+void frame_profiler_end_frame();
+const char* frame_profiler_get_section_name(FRAME_PROFILER_SECTION section);
+rct_string_id frame_profiler_get_section_string_id(FRAME_PROFILER_SECTION section);
+FrameProfilerStats frame_profiler_get_stats(FRAME_PROFILER_SECTION section);
+
+/**
+ * Records every measured section as a trace event until frame_profiler_write_trace is called. The trace is written in
+ * the Chrome trace event format, it can be opened in chrome://tracing or Perfetto.
+ */
+void frame_profiler_start_trace();
+bool frame_profiler_write_trace(const std::string& path);
+
+/**
+ * Measures the section for as long as it is in scope. Does nothing but check a flag when the profiler is disabled.
+ */
+class FrameProfilerScope
+{
+private:
+    FrameProfilerClock::time_point _start;
+    FRAME_PROFILER_SECTION _section;
+    bool _entered = false;
+    bool _active = false;
+
+public:
+    explicit FrameProfilerScope(FRAME_PROFILER_SECTION section);
+    ~FrameProfilerScope();
+
+    FrameProfilerScope(const FrameProfilerScope&) = delete;
+    FrameProfilerScope& operator=(const FrameProfilerScope&) = delete;
+};
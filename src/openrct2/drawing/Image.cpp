@@ -10,6 +10,7 @@
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
+#include "../paint/TilePaintCache.h"
 #include "../sprites.h"
 #include "Drawing.h"
 
@@ -201,14 +202,17 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
         return INVALID_IMAGE_ID;
     }
 
+    // No need to invalidate the images in the drawing engine, they were either never used or got
+    // invalidated when they were last freed.
     uint32_t imageId = baseImageId;
     for (uint32_t i = 0; i < count; i++)
     {
         gfx_set_g1_element(imageId, &images[i]);
-        drawing_engine_invalidate_image(imageId);
         imageId++;
     }
 
+    // Tiles painted before the object was loaded did not use its images
+    tile_paint_cache_clear();
     return baseImageId;
 }
 
@@ -227,6 +231,7 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
         }
 
         FreeImageList(baseImageId, count);
+        tile_paint_cache_clear();
     }
 }
 
@@ -13,11 +13,13 @@
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
 #include "../interface/Screenshot.h"
+#include "../interface/Viewport.h"
 #include "../localisation/StringIds.h"
 #include "../paint/Painter.h"
 #include "../ui/UiContext.h"
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
+#include "ZoomedSpriteCache.h"
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -139,6 +141,8 @@ bool drawing_engine_has_dirty_optimisations()
 
 void drawing_engine_invalidate_image(uint32_t image)
 {
+    zoomed_sprite_cache_invalidate(image);
+
     auto drawingEngine = GetDrawingEngine();
     if (drawingEngine != nullptr)
     {
@@ -157,6 +161,8 @@ void drawing_engine_set_vsync(bool vsync)
 
 void gfx_set_dirty_blocks(int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
+    viewport_hit_test_invalidate(left, top, right, bottom);
+
     auto drawingEngine = GetDrawingEngine();
     if (drawingEngine != nullptr)
     {
@@ -56,6 +56,50 @@ void mask_sse4_1(
     }
 }
 
+void blit_transparent_sse4_1(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    const __m128i zero128 = {};
+    int32_t i = 0;
+    for (; i + 16 <= width; i += 16)
+    {
+        const __m128i colour = _mm_lddqu_si128((const __m128i*)(src + i));
+        const __m128i dest = _mm_lddqu_si128((const __m128i*)(dst + i));
+        const __m128i transparent = _mm_cmpeq_epi8(colour, zero128);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_blendv_epi8(colour, dest, transparent));
+    }
+    blit_transparent_scalar(width - i, src + i, dst + i);
+}
+
+void blit_sample_sse4_1(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    // Only whole blocks of the source are loaded, so nothing past srcWidth is read. The rest is left to the scalar version.
+    int32_t i = 0;
+    if (zoomLevel == 1)
+    {
+        const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+        for (; i + 32 <= srcWidth; i += 32, dst += 16)
+        {
+            const __m128i a = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i)), lowBytes);
+            const __m128i b = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i + 16)), lowBytes);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(a, b));
+        }
+    }
+    else if (zoomLevel == 2)
+    {
+        const __m128i lowBytes = _mm_set1_epi32(0x000000FF);
+        for (; i + 64 <= srcWidth; i += 64, dst += 16)
+        {
+            const __m128i a = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i)), lowBytes);
+            const __m128i b = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i + 16)), lowBytes);
+            const __m128i c = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i + 32)), lowBytes);
+            const __m128i d = _mm_and_si128(_mm_lddqu_si128((const __m128i*)(src + i + 48)), lowBytes);
+            // _mm_packus_epi32 is SSE4.1
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+        }
+    }
+    blit_sample_scalar(srcWidth - i, zoomLevel, src + i, dst);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +113,14 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void blit_transparent_sse4_1(int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void blit_sample_sse4_1(int32_t srcWidth, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -7,17 +7,22 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../interface/Colour.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
 #include "../paint/Paint.h"
+#include "../paint/TilePaintCache.h"
 #include "../sprites.h"
 #include "Drawing.h"
 #include "TTF.h"
 
 #include <algorithm>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 struct rct_draw_scroll_text
 {
@@ -27,20 +32,40 @@ struct rct_draw_scroll_text
     uint16_t position;
     uint16_t mode;
     uint32_t id;
+    uint32_t image_id;
     uint8_t bitmap[64 * 40];
 };
 
-constexpr int32_t MAX_SCROLLING_TEXT_ENTRIES = 32;
+/**
+ * The columns of a formatted string as they are drawn on a sign, 8 pixels per column from the top row down and 0 where
+ * nothing is drawn. The string starts in the colour of the sign the first time through and in the colour it ended
+ * with every time after that, so the columns are kept for both. Repeat is empty when they are the same.
+ */
+struct ScrollingTextStrip
+{
+    std::vector<uint8_t> FirstPass;
+    std::vector<uint8_t> Repeat;
+    // TrueType text only, bit n of a column is set when its pixel in row n is blended with what is already drawn there.
+    std::vector<uint8_t> Hinting;
+};
+
+// The first entries use the images reserved for scrolling text in g1, the others allocate theirs from the image list.
+constexpr int32_t MAX_SCROLLING_TEXT_ENTRIES = 256;
+constexpr int32_t NUM_RESERVED_SCROLLING_TEXT_ENTRIES = SPR_SCROLLING_TEXT_END - SPR_SCROLLING_TEXT_START;
+constexpr size_t MAX_SCROLLING_TEXT_STRIPS = 256;
+constexpr uint32_t INVALID_SCROLLING_TEXT_IMAGE_ID = UINT32_MAX;
 
 static rct_draw_scroll_text _drawScrollTextList[MAX_SCROLLING_TEXT_ENTRIES];
+static int32_t _numScrollingTextEntries = NUM_RESERVED_SCROLLING_TEXT_ENTRIES;
+static uint32_t _scrollingTextImageListBase = INVALID_SCROLLING_TEXT_IMAGE_ID;
+static std::unordered_map<uint64_t, int32_t> _drawScrollTextMap;
+static std::unordered_map<std::string, ScrollingTextStrip> _scrollingTextStrips;
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
 static uint32_t _drawSCrollNextIndex = 0;
 static std::mutex _scrollingTextMutex;
 
-static void scrolling_text_set_bitmap_for_sprite(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
-static void scrolling_text_set_bitmap_for_ttf(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
+static void scrolling_text_build_strip_for_sprite(const utf8* text, colour_t colour, ScrollingTextStrip& strip);
+static void scrolling_text_build_strip_for_ttf(utf8* text, colour_t colour, ScrollingTextStrip& strip);
 
 void scrolling_text_initialise_bitmaps()
 {
@@ -93,25 +118,78 @@ void scrolling_text_initialise_bitmaps()
         }
     }
 
+    for (int32_t i = 0; i < NUM_RESERVED_SCROLLING_TEXT_ENTRIES; i++)
+    {
+        _drawScrollTextList[i].image_id = SPR_SCROLLING_TEXT_START + i;
+    }
+
+    const rct_g1_element* g1original = gfx_get_g1_element(SPR_SCROLLING_TEXT_START);
+    if (g1original == nullptr)
+    {
+        return;
+    }
+
+    std::vector<rct_g1_element> images(MAX_SCROLLING_TEXT_ENTRIES, *g1original);
     for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
     {
-        int32_t imageId = SPR_SCROLLING_TEXT_START + i;
-        const rct_g1_element* g1original = gfx_get_g1_element(imageId);
-        if (g1original != nullptr)
+        rct_g1_element& g1 = images[i];
+        g1.offset = _drawScrollTextList[i].bitmap;
+        g1.width = 64;
+        g1.height = 40;
+        g1.offset[0] = 0xFF;
+        g1.offset[1] = 0xFF;
+        g1.offset[14] = 0;
+        g1.offset[15] = 0;
+        g1.offset[16] = 0;
+        g1.offset[17] = 0;
+    }
+
+    for (int32_t i = 0; i < NUM_RESERVED_SCROLLING_TEXT_ENTRIES; i++)
+    {
+        gfx_set_g1_element(SPR_SCROLLING_TEXT_START + i, &images[i]);
+    }
+
+    constexpr uint32_t numExtraEntries = MAX_SCROLLING_TEXT_ENTRIES - NUM_RESERVED_SCROLLING_TEXT_ENTRIES;
+    if (_scrollingTextImageListBase == INVALID_SCROLLING_TEXT_IMAGE_ID)
+    {
+        _scrollingTextImageListBase = gfx_object_allocate_images(&images[NUM_RESERVED_SCROLLING_TEXT_ENTRIES], numExtraEntries);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < numExtraEntries; i++)
         {
-            rct_g1_element g1 = *g1original;
-            g1.offset = _drawScrollTextList[i].bitmap;
-            g1.width = 64;
-            g1.height = 40;
-            g1.offset[0] = 0xFF;
-            g1.offset[1] = 0xFF;
-            g1.offset[14] = 0;
-            g1.offset[15] = 0;
-            g1.offset[16] = 0;
-            g1.offset[17] = 0;
-            gfx_set_g1_element(imageId, &g1);
+            gfx_set_g1_element(_scrollingTextImageListBase + i, &images[NUM_RESERVED_SCROLLING_TEXT_ENTRIES + i]);
         }
     }
+
+    _numScrollingTextEntries = NUM_RESERVED_SCROLLING_TEXT_ENTRIES;
+    if (_scrollingTextImageListBase != INVALID_SCROLLING_TEXT_IMAGE_ID)
+    {
+        _numScrollingTextEntries = MAX_SCROLLING_TEXT_ENTRIES;
+        for (uint32_t i = 0; i < numExtraEntries; i++)
+        {
+            _drawScrollTextList[NUM_RESERVED_SCROLLING_TEXT_ENTRIES + i].image_id = _scrollingTextImageListBase + i;
+        }
+    }
+
+    // The glyph bitmaps may have changed
+    scrolling_text_invalidate();
+}
+
+/**
+ * Frees the images allocated for the scrolling text entries that did not fit in the images reserved in g1.
+ */
+void scrolling_text_dispose()
+{
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+    if (_scrollingTextImageListBase != INVALID_SCROLLING_TEXT_IMAGE_ID)
+    {
+        gfx_object_free_images(_scrollingTextImageListBase, MAX_SCROLLING_TEXT_ENTRIES - NUM_RESERVED_SCROLLING_TEXT_ENTRIES);
+        _scrollingTextImageListBase = INVALID_SCROLLING_TEXT_IMAGE_ID;
+    }
+    _numScrollingTextEntries = NUM_RESERVED_SCROLLING_TEXT_ENTRIES;
+    _drawScrollTextMap.clear();
+    _scrollingTextStrips.clear();
 }
 
 static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
@@ -127,27 +205,53 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     }
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(
-    rct_string_id stringId, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+static uint64_t scrolling_text_get_key(
+    rct_string_id stringId, const uint8_t* stringArgs, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
-    for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
-    {
-        rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+    // FNV-1a
+    uint64_t key = 14695981039346656037ULL;
+    auto addBytes = [&key](const void* data, size_t length) {
+        for (size_t i = 0; i < length; i++)
         {
-            oldestId = scrollText->id;
-            scrollIndex = i;
+            key = (key ^ static_cast<const uint8_t*>(data)[i]) * 1099511628211ULL;
         }
+    };
+    addBytes(&stringId, sizeof(stringId));
+    addBytes(stringArgs, sizeof(rct_draw_scroll_text::string_args));
+    addBytes(&scroll, sizeof(scroll));
+    addBytes(&scrollingMode, sizeof(scrollingMode));
+    addBytes(&colour, sizeof(colour));
+    return key;
+}
 
-        // If exact match return the matching index
+/**
+ * Returns the image of the entry that was drawn with the same text, scroll position and mode, otherwise the index of
+ * the least recently used entry.
+ */
+static int32_t scrolling_text_get_matching_or_oldest(
+    uint64_t key, rct_string_id stringId, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+{
+    auto it = _drawScrollTextMap.find(key);
+    if (it != _drawScrollTextMap.end())
+    {
+        rct_draw_scroll_text* scrollText = &_drawScrollTextList[it->second];
         if (scrollText->string_id == stringId
             && std::memcmp(scrollText->string_args, gCommonFormatArgs, sizeof(scrollText->string_args)) == 0
             && scrollText->colour == colour && scrollText->position == scroll && scrollText->mode == scrollingMode)
         {
             scrollText->id = _drawSCrollNextIndex;
-            return i + SPR_SCROLLING_TEXT_START;
+            return scrollText->image_id;
+        }
+    }
+
+    uint32_t oldestId = 0xFFFFFFFF;
+    int32_t scrollIndex = -1;
+    for (int32_t i = 0; i < _numScrollingTextEntries; i++)
+    {
+        if (oldestId >= _drawScrollTextList[i].id)
+        {
+            oldestId = _drawScrollTextList[i].id;
+            scrollIndex = i;
         }
     }
     return scrollIndex;
@@ -1433,12 +1537,88 @@ static constexpr const int16_t* _scrollPositions[MAX_SCROLLING_TEXT_MODES] = {
 
 void scrolling_text_invalidate()
 {
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
     for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
     {
         rct_draw_scroll_text& scrollText = _drawScrollTextList[i];
         scrollText.string_id = 0;
         std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
     }
+    _drawScrollTextMap.clear();
+    _scrollingTextStrips.clear();
+}
+
+/**
+ * Returns the columns of the formatted string, they only have to be built the first time the string is drawn rather
+ * than for every position it scrolls to.
+ */
+static const ScrollingTextStrip& scrolling_text_get_strip(const utf8* text, colour_t colour)
+{
+    bool useTrueTypeFont = LocalisationService_UseTrueTypeFont();
+    std::string key = text;
+    key.push_back('\0');
+    key.push_back(static_cast<char>(colour));
+    key.push_back(useTrueTypeFont ? 1 : 0);
+    key.push_back(gConfigFonts.enable_hinting ? 1 : 0);
+
+    auto it = _scrollingTextStrips.find(key);
+    if (it != _scrollingTextStrips.end())
+    {
+        return it->second;
+    }
+
+    if (_scrollingTextStrips.size() >= MAX_SCROLLING_TEXT_STRIPS)
+    {
+        _scrollingTextStrips.clear();
+    }
+
+    auto& strip = _scrollingTextStrips[key];
+    if (useTrueTypeFont)
+    {
+        std::string ttfText = text;
+        scrolling_text_build_strip_for_ttf(ttfText.data(), colour, strip);
+    }
+    else
+    {
+        scrolling_text_build_strip_for_sprite(text, colour, strip);
+    }
+    return strip;
+}
+
+static void scrolling_text_draw_strip(
+    const ScrollingTextStrip& strip, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+{
+    size_t numColumns = strip.FirstPass.size() / 8;
+    if (numColumns == 0)
+        return;
+
+    const auto& repeat = strip.Repeat.empty() ? strip.FirstPass : strip.Repeat;
+    for (size_t column = scroll; *scrollPositionOffsets != -1; scrollPositionOffsets++, column++)
+    {
+        int16_t scrollPosition = *scrollPositionOffsets;
+        if (scrollPosition < 0)
+            continue;
+
+        size_t index = column < numColumns ? column : (column - numColumns) % numColumns;
+        const uint8_t* pixels = column < numColumns ? &strip.FirstPass[index * 8] : &repeat[index * 8];
+        uint8_t hinting = strip.Hinting.empty() ? 0 : strip.Hinting[index];
+        uint8_t* dst = &bitmap[scrollPosition];
+        for (int32_t row = 0; row < 8; row++)
+        {
+            if (hinting & (1 << row))
+            {
+                // Simulate font hinting by shading the background colour instead.
+                *dst = blendColours(pixels[row], *dst);
+            }
+            else if (pixels[row] != 0)
+            {
+                *dst = pixels[row];
+            }
+
+            // Jump to next row
+            dst += 64;
+        }
+    }
 }
 
 int32_t scrolling_text_setup(
@@ -1448,6 +1628,9 @@ int32_t scrolling_text_setup(
 
     assert(scrollingMode < MAX_SCROLLING_TEXT_MODES);
 
+    // The text scrolls from one frame to the next
+    tile_paint_cache_set_volatile(session);
+
     rct_drawpixelinfo* dpi = &session->DPI;
 
     if (dpi->zoom_level != 0)
@@ -1455,12 +1638,21 @@ int32_t scrolling_text_setup(
 
     _drawSCrollNextIndex++;
 
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, scroll, scrollingMode, colour);
+    uint64_t key = scrolling_text_get_key(stringId, gCommonFormatArgs, scroll, scrollingMode, colour);
+    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(key, stringId, scroll, scrollingMode, colour);
     if (scrollIndex >= SPR_SCROLLING_TEXT_START)
         return scrollIndex;
 
     // Setup scrolling text
     auto scrollText = &_drawScrollTextList[scrollIndex];
+    auto oldKey = scrolling_text_get_key(
+        scrollText->string_id, scrollText->string_args, scrollText->position, scrollText->mode, scrollText->colour);
+    auto oldIt = _drawScrollTextMap.find(oldKey);
+    if (oldIt != _drawScrollTextMap.end() && oldIt->second == scrollIndex)
+    {
+        _drawScrollTextMap.erase(oldIt);
+    }
+    _drawScrollTextMap[key] = scrollIndex;
     scrollText->string_id = stringId;
     std::memcpy(scrollText->string_args, gCommonFormatArgs, sizeof(scrollText->string_args));
     scrollText->colour = colour;
@@ -1475,37 +1667,20 @@ int32_t scrolling_text_setup(
     const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
 
     std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
-    if (LocalisationService_UseTrueTypeFont())
-    {
-        scrolling_text_set_bitmap_for_ttf(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
-    }
-    else
-    {
-        scrolling_text_set_bitmap_for_sprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
-    }
+    const auto& strip = scrolling_text_get_strip(scrollString, colour);
+    scrolling_text_draw_strip(strip, scroll, scrollText->bitmap, scrollingModePositions);
 
-    uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
+    uint32_t imageId = scrollText->image_id;
     drawing_engine_invalidate_image(imageId);
     return imageId;
 }
 
-static void scrolling_text_set_bitmap_for_sprite(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static void scrolling_text_add_sprite_columns(const utf8* text, colour_t& characterColour, std::vector<uint8_t>& columns)
 {
-    auto characterColour = colour;
-
-    utf8* ch = text;
-    while (true)
+    const utf8* ch = text;
+    uint32_t codepoint;
+    while ((codepoint = utf8_get_next(ch, &ch)) != 0)
     {
-        uint32_t codepoint = utf8_get_next(ch, (const utf8**)&ch);
-
-        // If at the end of the string loop back to the start
-        if (codepoint == 0)
-        {
-            ch = text;
-            continue;
-        }
-
         // Set any change in colour
         if (codepoint <= FORMAT_COLOUR_CODE_END && codepoint >= FORMAT_COLOUR_CODE_START)
         {
@@ -1524,43 +1699,35 @@ static void scrolling_text_set_bitmap_for_sprite(
 
         int32_t characterWidth = font_sprite_get_codepoint_width(FONT_SPRITE_BASE_TINY, codepoint);
         uint8_t* characterBitmap = font_sprite_get_codepoint_bitmap(codepoint);
-        for (; characterWidth != 0; characterWidth--, characterBitmap++)
+        for (; characterWidth > 0; characterWidth--, characterBitmap++)
         {
-            // Skip any non-displayed columns
-            if (scroll != 0)
+            uint8_t char_bitmap = *characterBitmap;
+            for (int32_t row = 0; row < 8; row++, char_bitmap >>= 1)
             {
-                scroll--;
-                continue;
+                columns.push_back((char_bitmap & 1) ? characterColour : 0);
             }
-
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-            if (scrollPosition > -1)
-            {
-                uint8_t* dst = &bitmap[scrollPosition];
-                for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1)
-                {
-                    if (char_bitmap & 1)
-                        *dst = characterColour;
-
-                    // Jump to next row
-                    dst += 64;
-                }
-            }
-            scrollPositionOffsets++;
         }
     }
 }
 
-static void scrolling_text_set_bitmap_for_ttf(
-    utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static void scrolling_text_build_strip_for_sprite(const utf8* text, colour_t colour, ScrollingTextStrip& strip)
+{
+    colour_t characterColour = colour;
+    scrolling_text_add_sprite_columns(text, characterColour, strip.FirstPass);
+    if (characterColour != colour)
+    {
+        // The string is drawn again and again, each time starting in the colour it ended with
+        scrolling_text_add_sprite_columns(text, characterColour, strip.Repeat);
+    }
+}
+
+static void scrolling_text_build_strip_for_ttf(utf8* text, colour_t colour, ScrollingTextStrip& strip)
 {
 #ifndef NO_TTF
     TTFFontDescriptor* fontDesc = ttf_get_font_from_sprite_base(FONT_SPRITE_BASE_TINY);
     if (fontDesc->font == nullptr)
     {
-        scrolling_text_set_bitmap_for_sprite(text, scroll, bitmap, scrollPositionOffsets, colour);
+        scrolling_text_build_strip_for_sprite(text, colour, strip);
         return;
     }
 
@@ -1607,45 +1774,31 @@ static void scrolling_text_set_bitmap_for_ttf(
 
     bool use_hinting = gConfigFonts.enable_hinting && fontDesc->hinting_threshold > 0;
 
-    for (int32_t x = 0;; x++)
+    // The text is the same colour throughout, so every time through it is drawn the same way
+    strip.FirstPass.assign(width * 8, 0);
+    strip.Hinting.assign(width, 0);
+    for (int32_t x = 0; x < width; x++)
     {
-        if (x >= width)
-            x = 0;
-
-        // Skip any non-displayed columns
-        if (scroll == 0)
+        uint8_t* dst = &strip.FirstPass[x * 8];
+        int32_t row = 0;
+        for (int32_t y = min_vpos; y < max_vpos; y++)
         {
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-
-            if (scrollPosition > -1)
+            uint8_t src_pixel = src[y * pitch + x];
+            if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
             {
-                uint8_t* dst = &bitmap[scrollPosition];
-
-                for (int32_t y = min_vpos; y < max_vpos; y++)
-                {
-                    uint8_t src_pixel = src[y * pitch + x];
-                    if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
-                    {
-                        // Centre of the glyph: use full colour.
-                        *dst = colour;
-                    }
-                    else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
-                    {
-                        // Simulate font hinting by shading the background colour instead.
-                        *dst = blendColours(colour, *dst);
-                    }
-
-                    // Jump to next row
-                    dst += 64;
-                }
+                // Centre of the glyph: use full colour.
+                *dst = colour;
             }
-            scrollPositionOffsets++;
-        }
-        else
-        {
-            scroll--;
+            else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
+            {
+                // Blended with the sign when the column is drawn
+                *dst = colour;
+                strip.Hinting[x] |= 1 << row;
+            }
+
+            // Next row
+            dst++;
+            row++;
         }
     }
 #endif // NO_TTF
@@ -16,8 +16,10 @@
 #include "../interface/Screenshot.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
+#include "../interface/Window_internal.h"
 #include "../ui/UiContext.h"
 #include "Drawing.h"
+#include "FrameProfiler.h"
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 #include "LightFX.h"
@@ -375,12 +377,105 @@ void X8DrawingEngine::ConfigureDirtyGrid()
     _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
 }
 
+/**
+ * Joins nearby dirty blocks so that fewer, larger regions are drawn. Every region is a separate window_draw_all and
+ * viewport paint, regenerating and sorting the tiles along its edges again, which costs more than drawing a few clean
+ * blocks. When most of the area around the dirty blocks needs drawing anyway it is all drawn in one pass.
+ */
+void X8DrawingEngine::MergeDirtyBlocks()
+{
+    // A clean gap of up to this many blocks between two dirty blocks is drawn as well
+    static constexpr uint32_t MaxGap = 1;
+
+    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
+    uint32_t dirtyBlockRows = _dirtyGrid.BlockRows;
+    uint8_t* dirtyBlocks = _dirtyGrid.Blocks;
+
+    uint32_t left = dirtyBlockColumns;
+    uint32_t top = dirtyBlockRows;
+    uint32_t right = 0;
+    uint32_t bottom = 0;
+    uint32_t numDirtyBlocks = 0;
+    for (uint32_t y = 0; y < dirtyBlockRows; y++)
+    {
+        uint32_t yOffset = y * dirtyBlockColumns;
+        for (uint32_t x = 0; x < dirtyBlockColumns; x++)
+        {
+            if (dirtyBlocks[yOffset + x] != 0)
+            {
+                left = std::min(left, x);
+                top = std::min(top, y);
+                right = std::max(right, x + 1);
+                bottom = std::max(bottom, y + 1);
+                numDirtyBlocks++;
+            }
+        }
+    }
+    if (numDirtyBlocks == 0)
+    {
+        return;
+    }
+
+    // Draw the whole bounding box in one pass if at least half of it is dirty
+    uint32_t boundsArea = (right - left) * (bottom - top);
+    if (numDirtyBlocks * 2 >= boundsArea)
+    {
+        for (uint32_t y = top; y < bottom; y++)
+        {
+            std::fill_n(&dirtyBlocks[y * dirtyBlockColumns + left], right - left, 0xFF);
+        }
+        return;
+    }
+
+    // Otherwise close small gaps along rows, then along columns
+    for (uint32_t y = top; y < bottom; y++)
+    {
+        uint32_t yOffset = y * dirtyBlockColumns;
+        uint32_t lastDirty = UINT32_MAX;
+        for (uint32_t x = left; x < right; x++)
+        {
+            if (dirtyBlocks[yOffset + x] == 0)
+            {
+                continue;
+            }
+            if (lastDirty != UINT32_MAX && x - lastDirty - 1 <= MaxGap)
+            {
+                std::fill(&dirtyBlocks[yOffset + lastDirty + 1], &dirtyBlocks[yOffset + x], 0xFF);
+            }
+            lastDirty = x;
+        }
+    }
+    for (uint32_t x = left; x < right; x++)
+    {
+        uint32_t lastDirty = UINT32_MAX;
+        for (uint32_t y = top; y < bottom; y++)
+        {
+            if (dirtyBlocks[y * dirtyBlockColumns + x] == 0)
+            {
+                continue;
+            }
+            if (lastDirty != UINT32_MAX && y - lastDirty - 1 <= MaxGap)
+            {
+                for (uint32_t yy = lastDirty + 1; yy < y; yy++)
+                {
+                    dirtyBlocks[yy * dirtyBlockColumns + x] = 0xFF;
+                }
+            }
+            lastDirty = y;
+        }
+    }
+}
+
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
+    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_DRAW_DIRTY_BLOCKS);
+    MergeDirtyBlocks();
+
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
     uint32_t dirtyBlockRows = _dirtyGrid.BlockRows;
     uint8_t* dirtyBlocks = _dirtyGrid.Blocks;
 
+    _dirtyRects.clear();
     for (uint32_t x = 0; x < dirtyBlockColumns; x++)
     {
         for (uint32_t y = 0; y < dirtyBlockRows; y++)
@@ -418,38 +513,93 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
 
         endRowCheck:
             uint32_t rows = yy - y;
-            DrawDirtyBlocks(x, y, columns, rows);
+
+            // Unset dirty blocks
+            for (uint32_t top = y; top < y + rows; top++)
+            {
+                uint32_t topOffset = top * dirtyBlockColumns;
+                for (uint32_t left = x; left < x + columns; left++)
+                {
+                    dirtyBlocks[topOffset + left] = 0;
+                }
+            }
+            _dirtyRects.push_back({ x, y, columns, rows });
         }
     }
+
+    PrepareDirtyBlocks();
+    for (const auto& rect : _dirtyRects)
+    {
+        DrawDirtyBlocks(rect);
+    }
+    viewport_free_prepared_render();
 }
 
-void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+/**
+ * Generates the main viewport for all the dirty regions at the same time on the paint job threads, rather than for
+ * one region at a time while they are drawn. Only regions where nothing but the main window is visible are prepared,
+ * in other regions the viewport is split up around the windows above it.
+ */
+void X8DrawingEngine::PrepareDirtyBlocks()
 {
-    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
-    uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
+    if (!gConfigGeneral.multithreading || _dirtyRects.size() < 2)
+    {
+        return;
+    }
+
+    rct_window* mainWindow = window_get_main();
+    if (mainWindow == nullptr || mainWindow->viewport == nullptr || !window_is_visible(mainWindow))
+    {
+        return;
+    }
 
-    // Unset dirty blocks
-    for (uint32_t top = y; top < y + rows; top++)
+    for (const auto& rect : _dirtyRects)
     {
-        uint32_t topOffset = top * dirtyBlockColumns;
-        for (uint32_t left = x; left < x + columns; left++)
+        uint32_t left, top, right, bottom;
+        if (!GetDirtyBlocksRegion(rect, &left, &top, &right, &bottom))
         {
-            screenDirtyBlocks[topOffset + left] = 0;
+            continue;
+        }
+
+        bool covered = false;
+        window_visit_each([&](rct_window* w) {
+            if (w == mainWindow || !window_is_visible(w))
+                return;
+            if ((int32_t)right <= w->x || (int32_t)bottom <= w->y)
+                return;
+            if ((int32_t)left >= w->x + w->width || (int32_t)top >= w->y + w->height)
+                return;
+            covered = true;
+        });
+        if (!covered)
+        {
+            viewport_prepare_render(&_bitsDPI, mainWindow->viewport, left, top, right, bottom);
         }
     }
+    viewport_wait_for_prepared_render();
+}
 
+bool X8DrawingEngine::GetDirtyBlocksRegion(
+    const DirtyBlockRect& rect, uint32_t* left, uint32_t* top, uint32_t* right, uint32_t* bottom) const
+{
+    *left = rect.X * _dirtyGrid.BlockWidth;
+    *top = rect.Y * _dirtyGrid.BlockHeight;
+    *right = std::min(_width, *left + (rect.Columns * _dirtyGrid.BlockWidth));
+    *bottom = std::min(_height, *top + (rect.Rows * _dirtyGrid.BlockHeight));
+    return *right > *left && *bottom > *top;
+}
+
+void X8DrawingEngine::DrawDirtyBlocks(const DirtyBlockRect& rect)
+{
     // Determine region in pixels
-    uint32_t left = std::max<uint32_t>(0, x * _dirtyGrid.BlockWidth);
-    uint32_t top = std::max<uint32_t>(0, y * _dirtyGrid.BlockHeight);
-    uint32_t right = std::min(_width, left + (columns * _dirtyGrid.BlockWidth));
-    uint32_t bottom = std::min(_height, top + (rows * _dirtyGrid.BlockHeight));
-    if (right <= left || bottom <= top)
+    uint32_t left, top, right, bottom;
+    if (!GetDirtyBlocksRegion(rect, &left, &top, &right, &bottom))
     {
         return;
     }
 
     // Draw region
-    OnDrawDirtyBlock(x, y, columns, rows);
+    OnDrawDirtyBlock(rect.X, rect.Y, rect.Columns, rect.Rows);
     window_draw_all(&_bitsDPI, left, top, right, bottom);
 }
 
@@ -13,6 +13,8 @@
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
+#include <vector>
+
 namespace OpenRCT2
 {
     namespace Ui
@@ -35,6 +37,14 @@ namespace OpenRCT2
             uint8_t* Blocks;
         };
 
+        struct DirtyBlockRect
+        {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Columns;
+            uint32_t Rows;
+        };
+
         class X8RainDrawer final : public IRainDrawer
         {
         private:
@@ -73,6 +83,7 @@ namespace OpenRCT2
             uint8_t* _bits = nullptr;
 
             DirtyGrid _dirtyGrid = {};
+            std::vector<DirtyBlockRect> _dirtyRects;
 
             rct_drawpixelinfo _bitsDPI = {};
 
@@ -113,8 +124,12 @@ namespace OpenRCT2
         private:
             void ConfigureDirtyGrid();
             static void ResetWindowVisbilities();
+            void MergeDirtyBlocks();
             void DrawAllDirtyBlocks();
-            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
+            void PrepareDirtyBlocks();
+            bool GetDirtyBlocksRegion(
+                const DirtyBlockRect& rect, uint32_t* left, uint32_t* top, uint32_t* right, uint32_t* bottom) const;
+            void DrawDirtyBlocks(const DirtyBlockRect& rect);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -0,0 +1,185 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ZoomedSpriteCache.h"
+
+#include "Drawing.h"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+// Once the decoded sprites take up more memory than this, the least recently drawn ones are dropped
+static constexpr size_t ZOOMED_SPRITE_CACHE_MAX_SIZE = 32 * 1024 * 1024;
+static constexpr int32_t ZOOMED_SPRITE_CACHE_MAX_ZOOM = 3;
+
+struct ZoomedSpriteCacheEntry
+{
+    uint32_t Key;
+    size_t Size;
+    ZoomedSprite Sprite;
+};
+
+// Sprites are only drawn from one thread, so the cache does not need a lock
+static std::list<ZoomedSpriteCacheEntry> _zoomedSprites;
+static std::unordered_map<uint32_t, std::list<ZoomedSpriteCacheEntry>::iterator> _zoomedSpriteMap;
+static size_t _zoomedSpriteCacheSize = 0;
+
+static uint32_t zoomed_sprite_cache_get_key(uint32_t imageIndex, int32_t zoomLevel)
+{
+    return (imageIndex << 2) | (uint32_t)zoomLevel;
+}
+
+static void zoomed_sprite_cache_remove(std::list<ZoomedSpriteCacheEntry>::iterator entry)
+{
+    _zoomedSpriteCacheSize -= entry->Size;
+    _zoomedSpriteMap.erase(entry->Key);
+    _zoomedSprites.erase(entry);
+}
+
+static void zoomed_sprite_write_uint16(std::vector<uint8_t>& data, uint16_t value)
+{
+    data.push_back(value & 0xFF);
+    data.push_back(value >> 8);
+}
+
+static void zoomed_sprite_decode(ZoomedSprite& sprite, const rct_g1_element* g1, int32_t zoomLevel)
+{
+    int32_t zoomAmount = 1 << zoomLevel;
+    int32_t zoomedWidth = (g1->width + zoomAmount - 1) >> zoomLevel;
+    sprite.Source = g1->offset;
+    sprite.Width = g1->width;
+    sprite.Height = g1->height;
+    sprite.RowOffsets.resize(g1->height);
+    sprite.Data.clear();
+
+    std::vector<uint8_t> pixels(zoomedWidth);
+    std::vector<bool> opaque(zoomedWidth);
+    for (int32_t y = 0; y < g1->height; y++)
+    {
+        std::fill(opaque.begin(), opaque.end(), false);
+
+        const uint8_t* lineData = g1->offset + (g1->offset[y * 2] | (g1->offset[y * 2 + 1] << 8));
+        uint8_t isEndOfLine = 0;
+        while (!isEndOfLine)
+        {
+            uint8_t dataSize = *lineData++;
+            uint8_t firstPixelX = *lineData++;
+            isEndOfLine = dataSize & 0x80;
+            dataSize &= 0x7F;
+
+            // Keep the pixels that are on a column drawn at this zoom level
+            int32_t endX = std::min<int32_t>(firstPixelX + dataSize, g1->width);
+            for (int32_t x = (firstPixelX + zoomAmount - 1) & ~(zoomAmount - 1); x < endX; x += zoomAmount)
+            {
+                pixels[x >> zoomLevel] = lineData[x - firstPixelX];
+                opaque[x >> zoomLevel] = true;
+            }
+            lineData += dataSize;
+        }
+
+        // Count the runs first, they are written after their count
+        uint16_t numRuns = 0;
+        for (int32_t x = 0; x < zoomedWidth; x++)
+        {
+            if (opaque[x] && (x == 0 || !opaque[x - 1]))
+            {
+                numRuns++;
+            }
+        }
+
+        sprite.RowOffsets[y] = (uint32_t)sprite.Data.size();
+        zoomed_sprite_write_uint16(sprite.Data, numRuns);
+        for (int32_t x = 0; x < zoomedWidth;)
+        {
+            if (!opaque[x])
+            {
+                x++;
+                continue;
+            }
+
+            int32_t runEnd = x;
+            while (runEnd < zoomedWidth && opaque[runEnd])
+            {
+                runEnd++;
+            }
+            zoomed_sprite_write_uint16(sprite.Data, (uint16_t)x);
+            zoomed_sprite_write_uint16(sprite.Data, (uint16_t)(runEnd - x));
+            sprite.Data.insert(sprite.Data.end(), pixels.begin() + x, pixels.begin() + runEnd);
+            x = runEnd;
+        }
+    }
+    sprite.Data.shrink_to_fit();
+}
+
+/**
+ * Gets the zoomed version of an RLE sprite, decoding it if it is not in the cache. Returns nullptr if the sprite can
+ * not be cached, in which case it should be drawn from its RLE data.
+ */
+const ZoomedSprite* zoomed_sprite_cache_get(uint32_t imageIndex, const rct_g1_element* g1, int32_t zoomLevel)
+{
+    if (zoomLevel <= 0 || zoomLevel > ZOOMED_SPRITE_CACHE_MAX_ZOOM || g1->offset == nullptr
+        || !(g1->flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        return nullptr;
+    }
+
+    uint32_t key = zoomed_sprite_cache_get_key(imageIndex, zoomLevel);
+    auto it = _zoomedSpriteMap.find(key);
+    if (it != _zoomedSpriteMap.end())
+    {
+        auto entry = it->second;
+        const auto& sprite = entry->Sprite;
+        if (sprite.Source == g1->offset && sprite.Width == g1->width && sprite.Height == g1->height)
+        {
+            _zoomedSprites.splice(_zoomedSprites.begin(), _zoomedSprites, entry);
+            return &entry->Sprite;
+        }
+        zoomed_sprite_cache_remove(entry);
+    }
+
+    _zoomedSprites.emplace_front();
+    auto entry = _zoomedSprites.begin();
+    entry->Key = key;
+    zoomed_sprite_decode(entry->Sprite, g1, zoomLevel);
+    entry->Size = sizeof(ZoomedSpriteCacheEntry) + entry->Sprite.RowOffsets.size() * sizeof(uint32_t)
+        + entry->Sprite.Data.size();
+    if (entry->Size > ZOOMED_SPRITE_CACHE_MAX_SIZE)
+    {
+        _zoomedSprites.erase(entry);
+        return nullptr;
+    }
+
+    _zoomedSpriteMap[key] = entry;
+    _zoomedSpriteCacheSize += entry->Size;
+    while (_zoomedSpriteCacheSize > ZOOMED_SPRITE_CACHE_MAX_SIZE)
+    {
+        zoomed_sprite_cache_remove(std::prev(_zoomedSprites.end()));
+    }
+    return &entry->Sprite;
+}
+
+void zoomed_sprite_cache_invalidate(uint32_t imageIndex)
+{
+    for (int32_t zoomLevel = 1; zoomLevel <= ZOOMED_SPRITE_CACHE_MAX_ZOOM; zoomLevel++)
+    {
+        auto it = _zoomedSpriteMap.find(zoomed_sprite_cache_get_key(imageIndex, zoomLevel));
+        if (it != _zoomedSpriteMap.end())
+        {
+            zoomed_sprite_cache_remove(it->second);
+        }
+    }
+}
+
+void zoomed_sprite_cache_clear()
+{
+    _zoomedSprites.clear();
+    _zoomedSpriteMap.clear();
+    _zoomedSpriteCacheSize = 0;
+}
@@ -0,0 +1,37 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <vector>
+
+struct rct_g1_element;
+
+/**
+ * An RLE sprite decoded for drawing at a zoom level. Only every (2^zoom)th column is kept, all rows are kept as the
+ * rows that get drawn depend on where the sprite is on the screen.
+ */
+struct ZoomedSprite
+{
+    // The RLE data the sprite was decoded from, used to detect images that were replaced without being invalidated.
+    const uint8_t* Source;
+    int32_t Width;
+    int32_t Height;
+    // Offset into Data of each row.
+    std::vector<uint32_t> RowOffsets;
+    // For every row, the number of runs followed by the runs. Each run is its first zoomed column and length, both
+    // as uint16_t, followed by its pixels.
+    std::vector<uint8_t> Data;
+};
+
+const ZoomedSprite* zoomed_sprite_cache_get(uint32_t imageIndex, const rct_g1_element* g1, int32_t zoomLevel);
+void zoomed_sprite_cache_invalidate(uint32_t imageIndex);
+void zoomed_sprite_cache_clear();
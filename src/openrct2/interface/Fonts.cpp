@@ -11,6 +11,7 @@
 
 #include "../config/Config.h"
 #include "../core/String.hpp"
+#include "../drawing/Drawing.h"
 #include "../drawing/TTF.h"
 #include "../localisation/Language.h"
 #include "../localisation/LocalisationService.h"
@@ -134,6 +135,9 @@ static bool LoadCustomConfigFont(LocalisationService& localisationService)
 
 void TryLoadFonts(LocalisationService& localisationService)
 {
+    // The signs have to be drawn with the new font
+    scrolling_text_invalidate();
+
 #ifndef NO_TTF
     auto currentLanguage = localisationService.GetCurrentLanguage();
     TTFontFamily const* fontFamily = LanguagesDescriptors[currentLanguage].font_family;
@@ -1257,6 +1257,15 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     return 0;
 }
 
+static int32_t cc_show_game_loop(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto& stats = OpenRCT2::GetContext()->GetGameLoopStats();
+    console.WriteFormatLine("Update time: %.2f ms", stats.UpdateTimeMs);
+    console.WriteFormatLine("Updates: %llu", (unsigned long long)stats.Updates);
+    console.WriteFormatLine("Behind real time: %llu ms", (unsigned long long)stats.DroppedTimeMs);
+    return 0;
+}
+
 static int32_t cc_for_date([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -1677,6 +1686,7 @@ static constexpr const console_command console_command_table[] = {
     { "save_park", cc_save_park, "Save current state of park. If no name specified default path will be used.", "save_park [name]" },
     { "say", cc_say, "Say to other players.", "say <message>" },
     { "set", cc_set, "Sets the variable to the specified value.", "set <variable> <value>" },
+    { "show_game_loop", cc_show_game_loop, "Shows how long updates take and how far the game is behind real time.", "show_game_loop" },
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
     { "staff", cc_staff, "Staff management.", "staff <subcommand>" },
     { "terminate", cc_terminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
@@ -19,6 +19,7 @@
 #include "../core/Imaging.h"
 #include "../core/Optional.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/FrameProfiler.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
 #include "../platform/platform.h"
@@ -29,11 +30,14 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <random>
 #include <string>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -452,11 +456,90 @@ template<typename FN> static inline double MeasureFunctionTime(const FN& fn)
     return std::chrono::duration<double>(endTime - startTime).count();
 }
 
-static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
+/**
+ * Checks that the blit functions registered for this CPU draw exactly the same pixels as the scalar ones and measures
+ * how much faster they are, using runs of random pixels of the lengths found in sprites.
+ */
+static bool benchgfx_check_blit_functions()
+{
+    constexpr int32_t MAX_RUN_LENGTH = 256;
+    constexpr int32_t NUM_RUNS = 4096;
+
+    std::mt19937 rng(0);
+    std::vector<uint8_t> src(NUM_RUNS * MAX_RUN_LENGTH);
+    for (auto& pixel : src)
+    {
+        // Plenty of transparent pixels, as in actual sprites
+        pixel = (rng() % 4 == 0) ? 0 : (uint8_t)rng();
+    }
+    std::vector<int32_t> runLengths(NUM_RUNS);
+    for (auto& runLength : runLengths)
+    {
+        runLength = rng() % MAX_RUN_LENGTH;
+    }
+
+    std::vector<uint8_t> dstScalar(src.size());
+    std::vector<uint8_t> dstFast(src.size());
+    auto runAll = [&](auto fn, std::vector<uint8_t>& dst) {
+        for (int32_t i = 0; i < NUM_RUNS; i++)
+        {
+            fn(runLengths[i], &src[i * MAX_RUN_LENGTH], &dst[i * MAX_RUN_LENGTH]);
+        }
+    };
+
+    bool match = true;
+    auto transparentScalar = [](int32_t width, const uint8_t* s, uint8_t* d) { blit_transparent_scalar(width, s, d); };
+    auto transparentFast = [](int32_t width, const uint8_t* s, uint8_t* d) { blit_transparent_fn(width, s, d); };
+    double scalarTime = MeasureFunctionTime([&]() { runAll(transparentScalar, dstScalar); });
+    double fastTime = MeasureFunctionTime([&]() { runAll(transparentFast, dstFast); });
+    match &= dstScalar == dstFast;
+    std::printf("blit_transparent: %.2fx scalar speed\n", scalarTime / std::max(fastTime, 1e-9));
+
+    for (int32_t zoom = 0; zoom <= MAX_ZOOM_LEVEL; zoom++)
+    {
+        auto sampleScalar = [zoom](int32_t width, const uint8_t* s, uint8_t* d) { blit_sample_scalar(width, zoom, s, d); };
+        auto sampleFast = [zoom](int32_t width, const uint8_t* s, uint8_t* d) { blit_sample_fn(width, zoom, s, d); };
+        scalarTime = MeasureFunctionTime([&]() { runAll(sampleScalar, dstScalar); });
+        fastTime = MeasureFunctionTime([&]() { runAll(sampleFast, dstFast); });
+        match &= dstScalar == dstFast;
+        std::printf("blit_sample[%d]: %.2fx scalar speed\n", zoom, scalarTime / std::max(fastTime, 1e-9));
+    }
+
+    // A remap palette and the 64K entry table of a transparent one
+    std::vector<uint8_t> palette(256 * 256);
+    for (auto& entry : palette)
+    {
+        entry = (uint8_t)rng();
+    }
+    auto remapScalar = [&](int32_t width, const uint8_t* s, uint8_t* d) { blit_remap_scalar(width, s, d, palette.data()); };
+    auto remapFast = [&](int32_t width, const uint8_t* s, uint8_t* d) { blit_remap_fn(width, s, d, palette.data()); };
+    scalarTime = MeasureFunctionTime([&]() { runAll(remapScalar, dstScalar); });
+    fastTime = MeasureFunctionTime([&]() { runAll(remapFast, dstFast); });
+    match &= dstScalar == dstFast;
+    std::printf("blit_remap: %.2fx scalar speed\n", scalarTime / std::max(fastTime, 1e-9));
+
+    auto blendScalar = [&](int32_t width, const uint8_t* s, uint8_t* d) {
+        blit_remap_blend_scalar(width, s, d, palette.data());
+    };
+    auto blendFast = [&](int32_t width, const uint8_t* s, uint8_t* d) { blit_remap_blend_fn(width, s, d, palette.data()); };
+    scalarTime = MeasureFunctionTime([&]() { runAll(blendScalar, dstScalar); });
+    fastTime = MeasureFunctionTime([&]() { runAll(blendFast, dstFast); });
+    match &= dstScalar == dstFast;
+    std::printf("blit_remap_blend: %.2fx scalar speed\n", scalarTime / std::max(fastTime, 1e-9));
+
+    if (!match)
+    {
+        std::fprintf(stderr, "Blit functions do not draw the same pixels as the scalar versions.\n");
+    }
+    return match;
+}
+
+static bool benchgfx_render_screenshots(
+    const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount, const char* tracePath)
 {
     if (!context->LoadParkFromFile(inputPath))
     {
-        return;
+        return false;
     }
 
     gIntroState = INTRO_STATE_NONE;
@@ -481,8 +564,14 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
 
     const uint32_t totalRenderCount = iterationCount * MAX_ROTATIONS * MAX_ZOOM_LEVEL;
 
+    bool result = true;
     try
     {
+        if (tracePath != nullptr)
+        {
+            frame_profiler_start_trace();
+        }
+
         double totalTime = 0.0;
 
         std::array<double, MAX_ZOOM_LEVEL> zoomAverages;
@@ -509,6 +598,11 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
             zoomAverages[zoom] = zoomLevelTime / static_cast<double>(MAX_ROTATIONS * iterationCount);
         }
 
+        if (tracePath != nullptr && !frame_profiler_write_trace(tracePath))
+        {
+            result = false;
+        }
+
         const double average = totalTime / static_cast<double>(totalRenderCount);
         const auto engineStringId = DrawingEngineStringIds[DRAWING_ENGINE_SOFTWARE];
         const auto engineName = format_string(engineStringId, nullptr);
@@ -525,17 +619,29 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
     catch (const std::exception& e)
     {
         std::fprintf(stderr, "%s", e.what());
+        result = false;
     }
 
     for (auto& dpi : dpis)
         ReleaseDPI(dpi);
+    return result;
 }
 
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
+int32_t cmdline_for_gfxbench(const char** argv, int32_t argc, const char* tracePath)
 {
+    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+        {
+            argc = i;
+            break;
+        }
+    }
+
     if (argc != 1 && argc != 2)
     {
-        printf("Usage: openrct2 benchgfx <file> [<iteration_count>]\n");
+        printf("Usage: openrct2 benchgfx <file> [<iteration_count>] [--trace <trace_file>]\n");
         return -1;
     }
 
@@ -555,9 +661,18 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     {
         drawing_engine_init();
 
-        benchgfx_render_screenshots(inputPath, context, iterationCount);
+        if (!benchgfx_check_blit_functions())
+        {
+            drawing_engine_dispose();
+            return -1;
+        }
+        bool rendered = benchgfx_render_screenshots(inputPath, context, iterationCount, tracePath);
 
         drawing_engine_dispose();
+        if (!rendered)
+        {
+            return -1;
+        }
     }
 
     return 1;
@@ -744,7 +859,15 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         dpi = CreateDPI(viewport);
 
+        if (options->trace != nullptr)
+        {
+            frame_profiler_start_trace();
+        }
         RenderViewport(nullptr, viewport, dpi);
+        if (options->trace != nullptr && !frame_profiler_write_trace(options->trace))
+        {
+            throw std::runtime_error("Failed to write trace.");
+        }
         auto renderedPalette = screenshot_get_rendered_palette();
         WriteDpiToFile(outputPath, &dpi, renderedPalette);
     }
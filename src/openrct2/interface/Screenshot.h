@@ -29,6 +29,8 @@ struct ScreenshotOptions
     bool remove_litter = false;
     bool tidy_up_park = false;
     bool transparent = false;
+    // Path of a Chrome trace event file the times of the render are written to.
+    utf8* trace = nullptr;
 };
 
 void screenshot_check();
@@ -38,4 +40,4 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
+int32_t cmdline_for_gfxbench(const char** argv, int32_t argc, const char* tracePath);
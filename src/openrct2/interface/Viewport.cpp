@@ -17,7 +17,9 @@
 #include "../core/Guard.hpp"
 #include "../core/JobPool.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/FrameProfiler.h"
 #include "../paint/Paint.h"
+#include "../paint/TilePaintCache.h"
 #include "../peep/Staff.h"
 #include "../ride/Ride.h"
 #include "../ride/TrackDesign.h"
@@ -31,6 +33,7 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 
 using namespace OpenRCT2;
@@ -44,6 +47,34 @@ rct_viewport g_viewport_list[MAX_VIEWPORT_COUNT];
 rct_viewport* g_music_tracking_viewport;
 
 static std::unique_ptr<JobPool> _paintJobs;
+static std::vector<paint_session*> _preparedColumns;
+
+/**
+ * Everything that can be picked at a pixel of a viewport, in the order it is drawn. The tools pick the pixel under the
+ * cursor several times per update with different filters, those picks look through the hits instead of painting the
+ * pixel again. The hits are dropped when the pixel is marked dirty, as anything that changes what is drawn there has to
+ * redraw it, and on the next game tick. They point at tile elements, so they are also dropped whenever elements are
+ * inserted, removed or moved, which happens without ticks while the game is paused.
+ */
+struct ViewportHitTest
+{
+    const rct_viewport* Viewport = nullptr;
+    ScreenCoordsXY ScreenCoords;
+    // The viewport's position on the screen and the position of its view.
+    int16_t X;
+    int16_t Y;
+    int16_t ViewX;
+    int16_t ViewY;
+    uint8_t Zoom;
+    uint8_t Rotation;
+    uint32_t ViewFlags;
+    uint32_t Tick;
+    std::vector<InteractionInfo> Hits;
+};
+
+static constexpr size_t VIEWPORT_HIT_TEST_COUNT = 8;
+static std::array<ViewportHitTest, VIEWPORT_HIT_TEST_COUNT> _hitTests;
+static size_t _nextHitTest;
 
 int16_t gSavedViewX;
 int16_t gSavedViewY;
@@ -775,6 +806,38 @@ void viewport_update_smart_vehicle_follow(rct_window* window)
     window->viewport_target_sprite = window->viewport_focus_sprite.sprite_id;
 }
 
+/**
+ * Converts a screen region to the region of the view it shows, returns false if the viewport is not in the region.
+ */
+static bool viewport_get_view_region(
+    const rct_viewport* viewport, int32_t* left, int32_t* top, int32_t* right, int32_t* bottom)
+{
+    if (*right <= viewport->x)
+        return false;
+    if (*bottom <= viewport->y)
+        return false;
+    if (*left >= viewport->x + viewport->width)
+        return false;
+    if (*top >= viewport->y + viewport->height)
+        return false;
+
+    *left = std::max<int32_t>(*left - viewport->x, 0);
+    *right = std::min<int32_t>(*right - viewport->x, viewport->width);
+    *top = std::max<int32_t>(*top - viewport->y, 0);
+    *bottom = std::min<int32_t>(*bottom - viewport->y, viewport->height);
+
+    *left <<= viewport->zoom;
+    *right <<= viewport->zoom;
+    *top <<= viewport->zoom;
+    *bottom <<= viewport->zoom;
+
+    *left += viewport->view_x;
+    *right += viewport->view_x;
+    *top += viewport->view_y;
+    *bottom += viewport->view_y;
+    return true;
+}
+
 /**
  *
  *  rct2: 0x00685C02
@@ -789,33 +852,12 @@ void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
     std::vector<paint_session>* sessions)
 {
-    if (right <= viewport->x)
-        return;
-    if (bottom <= viewport->y)
-        return;
-    if (left >= viewport->x + viewport->width)
-        return;
-    if (top >= viewport->y + viewport->height)
-        return;
-
 #ifdef DEBUG_SHOW_DIRTY_BOX
     int32_t l = left, t = top, r = right, b = bottom;
 #endif
 
-    left = std::max<int32_t>(left - viewport->x, 0);
-    right = std::min<int32_t>(right - viewport->x, viewport->width);
-    top = std::max<int32_t>(top - viewport->y, 0);
-    bottom = std::min<int32_t>(bottom - viewport->y, viewport->height);
-
-    left <<= viewport->zoom;
-    right <<= viewport->zoom;
-    top <<= viewport->zoom;
-    bottom <<= viewport->zoom;
-
-    left += viewport->view_x;
-    right += viewport->view_x;
-    top += viewport->view_y;
-    bottom += viewport->view_y;
+    if (!viewport_get_view_region(viewport, &left, &top, &right, &bottom))
+        return;
 
     viewport_paint(viewport, dpi, left, top, right, bottom, sessions);
 
@@ -830,12 +872,14 @@ void viewport_render(
 
 static void viewport_fill_column(paint_session* session)
 {
+    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_FILL_COLUMN);
     paint_session_generate(session);
     paint_session_arrange(session);
 }
 
 static void viewport_paint_column(paint_session* session)
 {
+    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_PAINT_COLUMN);
     if (session->ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
                | VIEWPORT_FLAG_CLIP_VIEW)
@@ -865,21 +909,9 @@ static void viewport_paint_column(paint_session* session)
     paint_session_free(session);
 }
 
-/**
- *
- *  rct2: 0x00685CBF
- *  eax: left
- *  ebx: top
- *  edx: right
- *  esi: viewport
- *  edi: dpi
- *  ebp: bottom
- */
-void viewport_paint(
-    const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<paint_session>* sessions)
+static rct_drawpixelinfo viewport_get_paint_dpi(
+    const rct_viewport* viewport, const rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
-    uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
     uint16_t height = bottom - top;
     uint16_t bitmask = 0xFFFF & (0xFFFF << viewport->zoom);
@@ -888,8 +920,6 @@ void viewport_paint(
     height &= bitmask;
     left &= bitmask;
     top &= bitmask;
-    right = left + width;
-    bottom = top + height;
 
     int16_t x = (int16_t)(left - (int16_t)(viewport->view_x & bitmask));
     x >>= viewport->zoom;
@@ -907,13 +937,37 @@ void viewport_paint(
     dpi1.height = height;
     dpi1.pitch = (dpi->width + dpi->pitch) - (width >> viewport->zoom);
     dpi1.zoom_level = viewport->zoom;
+    return dpi1;
+}
 
-    // make sure, the compare operation is done in int16_t to avoid the loop becoming an infiniteloop.
-    // this as well as the [x += 32] in the loop causes signed integer overflow -> undefined behaviour.
-    int16_t rightBorder = dpi1.x + dpi1.width;
+/**
+ * Crops the paint dpi to the 32 pixel column starting at x.
+ */
+static rct_drawpixelinfo viewport_get_column_dpi(const rct_drawpixelinfo& dpi1, int16_t x)
+{
+    rct_drawpixelinfo dpi2 = dpi1;
+    if (x >= dpi2.x)
+    {
+        int16_t leftPitch = x - dpi2.x;
+        dpi2.width -= leftPitch;
+        dpi2.bits += leftPitch >> dpi2.zoom_level;
+        dpi2.pitch += leftPitch >> dpi2.zoom_level;
+        dpi2.x = x;
+    }
 
-    std::vector<paint_session*> columns;
+    int16_t paintRight = dpi2.x + dpi2.width;
+    if (paintRight >= x + 32)
+    {
+        int16_t rightPitch = paintRight - x - 32;
+        paintRight -= rightPitch;
+        dpi2.pitch += rightPitch >> dpi2.zoom_level;
+    }
+    dpi2.width = paintRight - dpi2.x;
+    return dpi2;
+}
 
+static bool viewport_update_paint_jobs(const rct_viewport* viewport)
+{
     bool useMultithreading = gConfigGeneral.multithreading;
     if (window_get_main() != nullptr && viewport != window_get_main()->viewport)
         useMultithreading = false;
@@ -926,32 +980,71 @@ void viewport_paint(
     {
         _paintJobs.reset();
     }
+    return useMultithreading;
+}
 
-    // Splits the area into 32 pixel columns and renders them
-    size_t index = 0;
-    for (x = floor2(dpi1.x, 32); x < rightBorder; x += 32, index++)
+/**
+ * Takes a column generated by viewport_prepare_render that covers exactly the same part of the view.
+ */
+static paint_session* viewport_take_prepared_column(const rct_drawpixelinfo& dpi2, uint32_t viewFlags)
+{
+    for (auto it = _preparedColumns.begin(); it != _preparedColumns.end(); it++)
     {
-        paint_session* session = paint_session_alloc(&dpi1, viewFlags);
-        columns.push_back(session);
-
-        rct_drawpixelinfo& dpi2 = session->DPI;
-        if (x >= dpi2.x)
+        auto session = *it;
+        const auto& preparedDPI = session->DPI;
+        if (preparedDPI.x == dpi2.x && preparedDPI.y == dpi2.y && preparedDPI.width == dpi2.width
+            && preparedDPI.height == dpi2.height && preparedDPI.zoom_level == dpi2.zoom_level
+            && session->ViewFlags == viewFlags)
         {
-            int16_t leftPitch = x - dpi2.x;
-            dpi2.width -= leftPitch;
-            dpi2.bits += leftPitch >> dpi2.zoom_level;
-            dpi2.pitch += leftPitch >> dpi2.zoom_level;
-            dpi2.x = x;
+            _preparedColumns.erase(it);
+            // Only the position of the view was used to generate the column, draw it to where it is needed now
+            session->DPI = dpi2;
+            return session;
         }
+    }
+    return nullptr;
+}
 
-        int16_t paintRight = dpi2.x + dpi2.width;
-        if (paintRight >= x + 32)
+/**
+ *
+ *  rct2: 0x00685CBF
+ *  eax: left
+ *  ebx: top
+ *  edx: right
+ *  esi: viewport
+ *  edi: dpi
+ *  ebp: bottom
+ */
+void viewport_paint(
+    const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
+    std::vector<paint_session>* sessions)
+{
+    uint32_t viewFlags = viewport->flags;
+    rct_drawpixelinfo dpi1 = viewport_get_paint_dpi(viewport, dpi, left, top, right, bottom);
+
+    // make sure, the compare operation is done in int16_t to avoid the loop becoming an infiniteloop.
+    // this as well as the [x += 32] in the loop causes signed integer overflow -> undefined behaviour.
+    int16_t rightBorder = dpi1.x + dpi1.width;
+
+    std::vector<paint_session*> columns;
+
+    bool useMultithreading = viewport_update_paint_jobs(viewport);
+    tile_paint_cache_update();
+
+    // Splits the area into 32 pixel columns and renders them
+    size_t index = 0;
+    for (int16_t x = floor2(dpi1.x, 32); x < rightBorder; x += 32, index++)
+    {
+        rct_drawpixelinfo dpi2 = viewport_get_column_dpi(dpi1, x);
+        paint_session* session = viewport_take_prepared_column(dpi2, viewFlags);
+        if (session != nullptr)
         {
-            int16_t rightPitch = paintRight - x - 32;
-            paintRight -= rightPitch;
-            dpi2.pitch += rightPitch >> dpi2.zoom_level;
+            columns.push_back(session);
+            continue;
         }
-        dpi2.width = paintRight - dpi2.x;
+
+        session = paint_session_alloc(&dpi2, viewFlags);
+        columns.push_back(session);
 
         if (useMultithreading)
         {
@@ -974,6 +1067,54 @@ void viewport_paint(
     }
 }
 
+/**
+ * Starts generating the columns the given screen region of a viewport will be drawn with on the paint job threads, so
+ * that the columns of several regions are generated at the same time. Windows are still drawn one region after another
+ * on the main thread and viewport_paint picks up the columns that were prepared for it.
+ */
+void viewport_prepare_render(
+    rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    if (!viewport_update_paint_jobs(viewport))
+        return;
+    if (!viewport_get_view_region(viewport, &left, &top, &right, &bottom))
+        return;
+
+    tile_paint_cache_update();
+    rct_drawpixelinfo dpi1 = viewport_get_paint_dpi(viewport, dpi, left, top, right, bottom);
+    int16_t rightBorder = dpi1.x + dpi1.width;
+    for (int16_t x = floor2(dpi1.x, 32); x < rightBorder; x += 32)
+    {
+        rct_drawpixelinfo dpi2 = viewport_get_column_dpi(dpi1, x);
+        paint_session* session = paint_session_alloc(&dpi2, viewport->flags);
+        _preparedColumns.push_back(session);
+        _paintJobs->AddTask([session]() -> void { viewport_fill_column(session); });
+    }
+}
+
+/**
+ * Waits until all the columns started by viewport_prepare_render have been generated.
+ */
+void viewport_wait_for_prepared_render()
+{
+    if (_paintJobs != nullptr)
+    {
+        _paintJobs->Join();
+    }
+}
+
+/**
+ * Releases the prepared columns that were not used, e.g. because a window was opened over their region.
+ */
+void viewport_free_prepared_render()
+{
+    for (auto session : _preparedColumns)
+    {
+        paint_session_free(session);
+    }
+    _preparedColumns.clear();
+}
+
 static void viewport_paint_weather_gloom(rct_drawpixelinfo* dpi)
 {
     auto paletteId = climate_get_weather_gloom_palette_id(gClimateCurrent);
@@ -1244,19 +1385,19 @@ void viewport_set_visibility(uint8_t mode)
 /**
  * Checks if a paint_struct sprite type is in the filter mask.
  */
-static bool PSSpriteTypeIsInFilter(paint_struct* ps, uint16_t filter)
+static bool PSSpriteTypeIsInFilter(uint8_t spriteType, uint16_t filter)
 {
-    if (ps->sprite_type == VIEWPORT_INTERACTION_ITEM_NONE
-        || ps->sprite_type == 11 // 11 as a type seems to not exist, maybe part of the typo mentioned later on.
-        || ps->sprite_type > VIEWPORT_INTERACTION_ITEM_BANNER)
+    if (spriteType == VIEWPORT_INTERACTION_ITEM_NONE
+        || spriteType == 11 // 11 as a type seems to not exist, maybe part of the typo mentioned later on.
+        || spriteType > VIEWPORT_INTERACTION_ITEM_BANNER)
         return false;
 
     uint16_t mask;
-    if (ps->sprite_type == VIEWPORT_INTERACTION_ITEM_BANNER)
+    if (spriteType == VIEWPORT_INTERACTION_ITEM_BANNER)
         // I think CS made a typo here. Let's replicate the original behaviour.
-        mask = 1 << (ps->sprite_type - 3);
+        mask = 1 << (spriteType - 3);
     else
-        mask = 1 << (ps->sprite_type - 1);
+        mask = 1 << (spriteType - 1);
 
     if (filter & mask)
     {
@@ -1554,14 +1695,12 @@ static bool is_sprite_interacted_with(rct_drawpixelinfo* dpi, int32_t imageId, i
 }
 
 /**
- *
- *  rct2: 0x0068862C
+ * Calls fn for every paint struct that has a pixel drawn at the pixel of the session, in the order they are drawn.
  */
-InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter)
+template<typename TFunc> static void viewport_visit_interacted_paint_structs(paint_session* session, TFunc fn)
 {
     paint_struct* ps = &session->PaintHead;
     rct_drawpixelinfo* dpi = &session->DPI;
-    InteractionInfo info{};
 
     while ((ps = ps->next_quadrant_ps) != nullptr)
     {
@@ -1572,10 +1711,7 @@ InteractionInfo set_interaction_info_from_paint_session(paint_session* session,
             ps = next_ps;
             if (is_sprite_interacted_with(dpi, ps->image_id, ps->x, ps->y))
             {
-                if (PSSpriteTypeIsInFilter(ps, filter))
-                {
-                    info = { ps };
-                }
+                fn(ps);
             }
             next_ps = ps->children;
         }
@@ -1585,18 +1721,100 @@ InteractionInfo set_interaction_info_from_paint_session(paint_session* session,
             if (is_sprite_interacted_with(
                     dpi, attached_ps->image_id, (attached_ps->x + ps->x) & 0xFFFF, (attached_ps->y + ps->y) & 0xFFFF))
             {
-                if (PSSpriteTypeIsInFilter(ps, filter))
-                {
-                    info = { ps };
-                }
+                fn(ps);
             }
         }
 
         ps = old_ps;
     }
+}
+
+/**
+ *
+ *  rct2: 0x0068862C
+ */
+InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter)
+{
+    InteractionInfo info{};
+    viewport_visit_interacted_paint_structs(session, [&info, filter](const paint_struct* ps) {
+        if (PSSpriteTypeIsInFilter(ps->sprite_type, filter))
+        {
+            info = { ps };
+        }
+    });
     return info;
 }
 
+static const ViewportHitTest& viewport_get_hit_test(
+    const rct_viewport* viewport, ScreenCoordsXY screenCoords, const rct_drawpixelinfo& dpi)
+{
+    uint8_t rotation = get_current_rotation();
+    for (const auto& hitTest : _hitTests)
+    {
+        if (hitTest.Viewport == viewport && hitTest.ScreenCoords.x == screenCoords.x && hitTest.ScreenCoords.y == screenCoords.y
+            && hitTest.X == viewport->x && hitTest.Y == viewport->y && hitTest.ViewX == viewport->view_x
+            && hitTest.ViewY == viewport->view_y && hitTest.Zoom == viewport->zoom && hitTest.Rotation == rotation
+            && hitTest.ViewFlags == viewport->flags && hitTest.Tick == gCurrentTicks)
+        {
+            return hitTest;
+        }
+    }
+
+    auto& hitTest = _hitTests[_nextHitTest];
+    _nextHitTest = (_nextHitTest + 1) % VIEWPORT_HIT_TEST_COUNT;
+    hitTest.Viewport = viewport;
+    hitTest.ScreenCoords = screenCoords;
+    hitTest.X = viewport->x;
+    hitTest.Y = viewport->y;
+    hitTest.ViewX = viewport->view_x;
+    hitTest.ViewY = viewport->view_y;
+    hitTest.Zoom = viewport->zoom;
+    hitTest.Rotation = rotation;
+    hitTest.ViewFlags = viewport->flags;
+    hitTest.Tick = gCurrentTicks;
+    hitTest.Hits.clear();
+
+    rct_drawpixelinfo hitDPI = dpi;
+    paint_session* session = paint_session_alloc(&hitDPI, viewport->flags);
+    paint_session_generate(session);
+    paint_session_arrange(session);
+    auto& hits = hitTest.Hits;
+    viewport_visit_interacted_paint_structs(session, [&hits](const paint_struct* ps) {
+        // A paint struct is hit again for each of its attached sprites that has a pixel there
+        if (hits.empty() || hits.back().Element != ps->tileElement || hits.back().Loc.x != ps->map_x
+            || hits.back().Loc.y != ps->map_y || hits.back().SpriteType != ps->sprite_type)
+        {
+            hits.emplace_back(ps);
+        }
+    });
+    paint_session_free(session);
+    return hitTest;
+}
+
+/**
+ * Drops the hits of the pixels in the given screen region, called whenever the region is marked dirty.
+ */
+void viewport_hit_test_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    for (auto& hitTest : _hitTests)
+    {
+        const auto& screenCoords = hitTest.ScreenCoords;
+        if (hitTest.Viewport != nullptr && screenCoords.x >= left && screenCoords.x <= right && screenCoords.y >= top
+            && screenCoords.y <= bottom)
+        {
+            hitTest.Viewport = nullptr;
+        }
+    }
+}
+
+void viewport_hit_test_clear()
+{
+    for (auto& hitTest : _hitTests)
+    {
+        hitTest.Viewport = nullptr;
+    }
+}
+
 /**
  *
  *  rct2: 0x00685ADC
@@ -1625,6 +1843,7 @@ void get_map_coordinates_from_pos_window(
     if (window != nullptr && window->viewport != nullptr)
     {
         rct_viewport* myviewport = window->viewport;
+        const ScreenCoordsXY cursorCoords = screenCoords;
         screenCoords.x -= (int32_t)myviewport->x;
         screenCoords.y -= (int32_t)myviewport->y;
         if (screenCoords.x >= 0 && screenCoords.x < (int32_t)myviewport->width && screenCoords.y >= 0
@@ -1643,11 +1862,26 @@ void get_map_coordinates_from_pos_window(
             dpi.zoom_level = myviewport->zoom;
             dpi.width = 1;
 
-            paint_session* session = paint_session_alloc(&dpi, myviewport->flags);
-            paint_session_generate(session);
-            paint_session_arrange(session);
-            info = set_interaction_info_from_paint_session(session, flags & 0xFFFF);
-            paint_session_free(session);
+            if (gOpenRCT2Headless)
+            {
+                // Nothing marks the screen dirty without a drawing engine, the hits could not be dropped
+                paint_session* session = paint_session_alloc(&dpi, myviewport->flags);
+                paint_session_generate(session);
+                paint_session_arrange(session);
+                info = set_interaction_info_from_paint_session(session, flags & 0xFFFF);
+                paint_session_free(session);
+            }
+            else
+            {
+                const auto& hitTest = viewport_get_hit_test(myviewport, cursorCoords, dpi);
+                for (const auto& hit : hitTest.Hits)
+                {
+                    if (PSSpriteTypeIsInFilter(hit.SpriteType, flags & 0xFFFF))
+                    {
+                        info = hit;
+                    }
+                }
+            }
         }
         if (viewport != nullptr)
             *viewport = myviewport;
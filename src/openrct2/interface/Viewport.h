@@ -146,6 +146,10 @@ void viewport_render(
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
     std::vector<paint_session>* sessions = nullptr);
+void viewport_prepare_render(
+    rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom);
+void viewport_wait_for_prepared_render();
+void viewport_free_prepared_render();
 
 CoordsXYZ viewport_adjust_for_map_height(const ScreenCoordsXY startCoords);
 
@@ -169,6 +173,8 @@ void get_map_coordinates_from_pos_window(
     TileElement** tileElement, rct_viewport** viewport);
 
 InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter);
+void viewport_hit_test_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom);
+void viewport_hit_test_clear();
 int32_t viewport_interaction_get_item_left(ScreenCoordsXY screenCoords, viewport_interaction_info* info);
 int32_t viewport_interaction_left_over(ScreenCoordsXY screenCoords);
 int32_t viewport_interaction_left_click(ScreenCoordsXY screenCoords);
@@ -18,6 +18,7 @@
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/FrameProfiler.h"
 #include "../interface/Cursors.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -2037,6 +2038,7 @@ bool window_is_visible(rct_window* w)
  */
 void window_draw_all(rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
+    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_DRAW_WINDOWS);
     rct_drawpixelinfo windowDPI = *dpi;
     windowDPI.bits = dpi->bits + left + ((dpi->width + dpi->pitch) * top);
     windowDPI.x = left;
@@ -3877,6 +3877,16 @@ enum
     STR_CREATE_DUCKS = 6331,
     STR_REMOVE_DUCKS = 6332,
 
+    STR_DEBUG_PAINT_SHOW_FRAME_PROFILER = 6333,
+    STR_FRAME_PROFILER_HEADER = 6334,
+    STR_FRAME_PROFILER_SECTION_TIMES = 6335,
+    STR_FRAME_PROFILER_SECTION_FILL_COLUMN = 6336,
+    STR_FRAME_PROFILER_SECTION_ARRANGE = 6337,
+    STR_FRAME_PROFILER_SECTION_PAINT_COLUMN = 6338,
+    STR_FRAME_PROFILER_SECTION_DRAW_WINDOWS = 6339,
+    STR_FRAME_PROFILER_SECTION_DRAW_DIRTY_BLOCKS = 6340,
+    STR_FRAME_PROFILER_SECTION_PRESENT = 6341,
+
     // Have to include resource strings (from scenarios and objects) for the time being now that language is partially working
     STR_COUNT = 32768
 };
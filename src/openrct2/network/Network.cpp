@@ -31,7 +31,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "2"
+#define NETWORK_STREAM_VERSION "3"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -195,6 +195,8 @@ public:
     void Server_Send_OBJECTS(NetworkConnection& connection, const std::vector<const ObjectRepositoryItem*>& objects) const;
 
     NetworkStats_t GetStats() const;
+    size_t GetQueuedPacketCount() const;
+    size_t GetFlushedPacketCount() const;
     json_t* GetServerInfoAsJson() const;
 
     std::vector<std::unique_ptr<NetworkPlayer>> player_list;
@@ -249,6 +251,7 @@ private:
     int32_t mode = NETWORK_MODE_NONE;
     int32_t status = NETWORK_STATUS_NONE;
     bool _closeLock = false;
+    size_t _flushedPacketCount = 0;
     bool _requireClose = false;
     bool _requireReconnect = false;
     bool wsa_initialized = false;
@@ -692,6 +695,7 @@ void Network::Update()
 
 void Network::Flush()
 {
+    _flushedPacketCount = GetQueuedPacketCount();
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
@@ -1475,6 +1479,28 @@ NetworkStats_t Network::GetStats() const
     return stats;
 }
 
+size_t Network::GetQueuedPacketCount() const
+{
+    size_t count = 0;
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        count = _serverConnection->GetQueuedPacketCount();
+    }
+    else
+    {
+        for (auto& connection : client_connection_list)
+        {
+            count += connection->GetQueuedPacketCount();
+        }
+    }
+    return count;
+}
+
+size_t Network::GetFlushedPacketCount() const
+{
+    return _flushedPacketCount;
+}
+
 void Network::Server_Send_AUTH(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -3595,6 +3621,11 @@ uint8_t network_get_default_group()
     return gNetwork.GetDefaultGroup();
 }
 
+void network_set_default_group(uint8_t id)
+{
+    gNetwork.SetDefaultGroup(id);
+}
+
 int32_t network_get_num_actions()
 {
     return (int32_t)NetworkActions::Actions.size();
@@ -3831,6 +3862,11 @@ NetworkStats_t network_get_stats()
     return gNetwork.GetStats();
 }
 
+uint32_t network_get_flushed_packet_count()
+{
+    return (uint32_t)gNetwork.GetFlushedPacketCount();
+}
+
 NetworkServerState_t network_get_server_state()
 {
     return gNetwork.GetServerState();
@@ -3995,6 +4031,9 @@ uint8_t network_get_default_group()
 {
     return 0;
 }
+void network_set_default_group(uint8_t id)
+{
+}
 int32_t network_get_num_actions()
 {
     return 0;
@@ -4094,6 +4133,10 @@ NetworkStats_t network_get_stats()
 {
     return NetworkStats_t{};
 }
+uint32_t network_get_flushed_packet_count()
+{
+    return 0;
+}
 NetworkServerState_t network_get_server_state()
 {
     return NetworkServerState_t{};
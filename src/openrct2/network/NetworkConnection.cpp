@@ -140,6 +140,11 @@ void NetworkConnection::SendQueuedPackets()
     }
 }
 
+size_t NetworkConnection::GetQueuedPacketCount() const
+{
+    return _outboundPackets.size();
+}
+
 void NetworkConnection::ResetLastPacketTime()
 {
     _lastPacketTime = platform_get_ticks();
@@ -43,6 +43,7 @@ public:
     int32_t ReadPacket();
     void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
     void SendQueuedPackets();
+    size_t GetQueuedPacketCount() const;
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -0,0 +1,307 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "SyntheticClient.h"
+
+#    include "../actions/GameAction.h"
+#    include "../core/DataSerialiser.h"
+#    include "../platform/platform.h"
+#    include "NetworkPacket.h"
+#    include "Socket.h"
+#    include "network.h"
+
+#    include <cstring>
+
+SyntheticClient::SyntheticClient(const std::string& name)
+    : _name(name)
+{
+}
+
+bool SyntheticClient::Connect(const std::string& host, uint16_t port)
+{
+    if (!_key.Generate())
+    {
+        _connection.SetLastDisconnectReason("Failed to generate key.");
+        _state = SYNTHETIC_CLIENT_STATE::DISCONNECTED;
+        return false;
+    }
+
+    _connection.Socket = CreateTcpSocket();
+    try
+    {
+        _connection.Socket->ConnectAsync(host, port);
+    }
+    catch (const std::exception& ex)
+    {
+        _connection.SetLastDisconnectReason(ex.what());
+        _state = SYNTHETIC_CLIENT_STATE::DISCONNECTED;
+        return false;
+    }
+    _connectStartTime = platform_get_ticks();
+    _state = SYNTHETIC_CLIENT_STATE::CONNECTING;
+    return true;
+}
+
+void SyntheticClient::Disconnect()
+{
+    if (_connection.Socket != nullptr)
+    {
+        _connection.Socket->Disconnect();
+    }
+    _state = SYNTHETIC_CLIENT_STATE::DISCONNECTED;
+}
+
+void SyntheticClient::Update()
+{
+    switch (_state)
+    {
+        case SYNTHETIC_CLIENT_STATE::NONE:
+        case SYNTHETIC_CLIENT_STATE::DISCONNECTED:
+            return;
+        case SYNTHETIC_CLIENT_STATE::CONNECTING:
+            switch (_connection.Socket->GetStatus())
+            {
+                case SOCKET_STATUS_RESOLVING:
+                case SOCKET_STATUS_CONNECTING:
+                    return;
+                case SOCKET_STATUS_CONNECTED:
+                    _state = SYNTHETIC_CLIENT_STATE::AUTHENTICATING;
+                    _connection.ResetLastPacketTime();
+                    SendCommand(NETWORK_COMMAND_TOKEN);
+                    break;
+                default:
+                    _connection.SetLastDisconnectReason(_connection.Socket->GetError());
+                    _state = SYNTHETIC_CLIENT_STATE::DISCONNECTED;
+                    return;
+            }
+            break;
+        default:
+            break;
+    }
+
+    int32_t packetStatus;
+    do
+    {
+        packetStatus = _connection.ReadPacket();
+        if (packetStatus == NETWORK_READPACKET_DISCONNECTED)
+        {
+            if (_connection.GetLastDisconnectReason() == nullptr)
+            {
+                _connection.SetLastDisconnectReason("Connection closed by server.");
+            }
+            _state = SYNTHETIC_CLIENT_STATE::DISCONNECTED;
+            return;
+        }
+        if (packetStatus == NETWORK_READPACKET_SUCCESS)
+        {
+            ProcessPacket(_connection.InboundPacket);
+            if (_state == SYNTHETIC_CLIENT_STATE::DISCONNECTED)
+            {
+                return;
+            }
+        }
+    } while (packetStatus == NETWORK_READPACKET_MORE_DATA || packetStatus == NETWORK_READPACKET_SUCCESS);
+    _connection.SendQueuedPackets();
+}
+
+void SyntheticClient::SendGameAction(const GameAction* action, uint32_t tick)
+{
+    if (_state != SYNTHETIC_CLIENT_STATE::JOINED)
+    {
+        return;
+    }
+
+    DataSerialiser stream(true);
+    action->Serialise(stream);
+
+    std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+    *packet << (uint32_t)NETWORK_COMMAND_GAME_ACTION << tick << action->GetType() << stream;
+    _connection.QueuePacket(std::move(packet));
+    _actionsSent++;
+}
+
+SYNTHETIC_CLIENT_STATE SyntheticClient::GetState() const
+{
+    return _state;
+}
+
+const std::string& SyntheticClient::GetName() const
+{
+    return _name;
+}
+
+const char* SyntheticClient::GetLastError() const
+{
+    return _connection.GetLastDisconnectReason();
+}
+
+const NetworkStats_t& SyntheticClient::GetStats() const
+{
+    return _connection.Stats;
+}
+
+uint32_t SyntheticClient::GetTicksReceived() const
+{
+    return _ticksReceived;
+}
+
+uint32_t SyntheticClient::GetTickGaps() const
+{
+    return _tickGaps;
+}
+
+uint32_t SyntheticClient::GetActionsSent() const
+{
+    return _actionsSent;
+}
+
+uint32_t SyntheticClient::GetErrorsReceived() const
+{
+    return _errorsReceived;
+}
+
+uint32_t SyntheticClient::GetJoinTime() const
+{
+    return _joinTime;
+}
+
+void SyntheticClient::ProcessPacket(NetworkPacket& packet)
+{
+    uint32_t command;
+    packet >> command;
+    switch (command)
+    {
+        case NETWORK_COMMAND_TOKEN:
+            HandleToken(packet);
+            break;
+        case NETWORK_COMMAND_AUTH:
+            HandleAuth(packet);
+            break;
+        case NETWORK_COMMAND_OBJECTS:
+            HandleObjects(packet);
+            break;
+        case NETWORK_COMMAND_MAP:
+            HandleMap(packet);
+            break;
+        case NETWORK_COMMAND_TICK:
+            HandleTick(packet);
+            break;
+        case NETWORK_COMMAND_PING:
+            SendCommand(NETWORK_COMMAND_PING);
+            break;
+        case NETWORK_COMMAND_SHOWERROR:
+            _errorsReceived++;
+            break;
+        case NETWORK_COMMAND_SETDISCONNECTMSG:
+        {
+            const char* reason = packet.ReadString();
+            if (reason != nullptr)
+            {
+                _connection.SetLastDisconnectReason(reason);
+            }
+            break;
+        }
+    }
+    packet.Clear();
+}
+
+void SyntheticClient::HandleToken(NetworkPacket& packet)
+{
+    uint32_t challengeSize;
+    packet >> challengeSize;
+    const uint8_t* challenge = packet.Read(challengeSize);
+    if (challenge == nullptr)
+    {
+        _connection.SetLastDisconnectReason("Invalid token packet.");
+        Disconnect();
+        return;
+    }
+
+    std::vector<uint8_t> signature;
+    if (!_key.Sign(challenge, challengeSize, signature))
+    {
+        _connection.SetLastDisconnectReason("Failed to sign server's challenge.");
+        Disconnect();
+        return;
+    }
+
+    std::unique_ptr<NetworkPacket> authPacket(NetworkPacket::Allocate());
+    *authPacket << (uint32_t)NETWORK_COMMAND_AUTH;
+    authPacket->WriteString(network_get_version().c_str());
+    authPacket->WriteString(_name.c_str());
+    authPacket->WriteString("");
+    authPacket->WriteString(_key.PublicKeyString().c_str());
+    *authPacket << (uint32_t)signature.size();
+    authPacket->Write(signature.data(), signature.size());
+    _connection.AuthStatus = NETWORK_AUTH_REQUESTED;
+    _connection.QueuePacket(std::move(authPacket));
+}
+
+void SyntheticClient::HandleAuth(NetworkPacket& packet)
+{
+    uint32_t authStatus;
+    uint8_t playerId;
+    packet >> authStatus >> playerId;
+    _connection.AuthStatus = (NETWORK_AUTH)authStatus;
+    if (_connection.AuthStatus == NETWORK_AUTH_OK)
+    {
+        _state = SYNTHETIC_CLIENT_STATE::DOWNLOADING_MAP;
+        SendCommand(NETWORK_COMMAND_GAMEINFO);
+    }
+    else
+    {
+        char reason[64];
+        snprintf(reason, sizeof(reason), "Authentication failed (status %u).", authStatus);
+        _connection.SetLastDisconnectReason(reason);
+        Disconnect();
+    }
+}
+
+void SyntheticClient::HandleObjects([[maybe_unused]] NetworkPacket& packet)
+{
+    // Pretend every object is available locally so the server sends the map straight away.
+    std::unique_ptr<NetworkPacket> objectsPacket(NetworkPacket::Allocate());
+    *objectsPacket << (uint32_t)NETWORK_COMMAND_OBJECTS << (uint32_t)0;
+    _connection.QueuePacket(std::move(objectsPacket));
+}
+
+void SyntheticClient::HandleMap(NetworkPacket& packet)
+{
+    uint32_t size, offset;
+    packet >> size >> offset;
+    uint32_t chunkSize = (uint32_t)(packet.Size - packet.BytesRead);
+    if (offset + chunkSize >= size && _state == SYNTHETIC_CLIENT_STATE::DOWNLOADING_MAP)
+    {
+        _state = SYNTHETIC_CLIENT_STATE::JOINED;
+        _joinTime = platform_get_ticks() - _connectStartTime;
+    }
+}
+
+void SyntheticClient::HandleTick(NetworkPacket& packet)
+{
+    uint32_t serverTick;
+    packet >> serverTick;
+    if (_ticksReceived != 0 && serverTick != _lastTick + 1)
+    {
+        _tickGaps++;
+    }
+    _lastTick = serverTick;
+    _ticksReceived++;
+}
+
+void SyntheticClient::SendCommand(uint32_t command)
+{
+    std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+    *packet << command;
+    _connection.QueuePacket(std::move(packet));
+}
+
+#endif // DISABLE_NETWORK
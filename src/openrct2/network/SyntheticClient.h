@@ -0,0 +1,80 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "../common.h"
+#    include "NetworkConnection.h"
+#    include "NetworkKey.h"
+
+#    include <string>
+#    include <vector>
+
+class GameAction;
+
+enum class SYNTHETIC_CLIENT_STATE
+{
+    NONE,
+    CONNECTING,
+    AUTHENTICATING,
+    DOWNLOADING_MAP,
+    JOINED,
+    DISCONNECTED,
+};
+
+/**
+ * A minimal headless client that speaks the multiplayer protocol without loading or simulating the park.
+ * It authenticates with a throw-away key, downloads (and discards) the map, acknowledges pings and can
+ * send game actions. Used to put load on a server, see the benchserver command.
+ */
+class SyntheticClient final
+{
+public:
+    explicit SyntheticClient(const std::string& name);
+
+    bool Connect(const std::string& host, uint16_t port);
+    void Disconnect();
+    void Update();
+    void SendGameAction(const GameAction* action, uint32_t tick);
+
+    SYNTHETIC_CLIENT_STATE GetState() const;
+    const std::string& GetName() const;
+    const char* GetLastError() const;
+    const NetworkStats_t& GetStats() const;
+    uint32_t GetTicksReceived() const;
+    uint32_t GetTickGaps() const;
+    uint32_t GetActionsSent() const;
+    uint32_t GetErrorsReceived() const;
+    uint32_t GetJoinTime() const;
+
+private:
+    std::string _name;
+    NetworkConnection _connection;
+    NetworkKey _key;
+    SYNTHETIC_CLIENT_STATE _state = SYNTHETIC_CLIENT_STATE::NONE;
+    uint32_t _lastTick = 0;
+    uint32_t _ticksReceived = 0;
+    uint32_t _tickGaps = 0;
+    uint32_t _actionsSent = 0;
+    uint32_t _errorsReceived = 0;
+    uint32_t _connectStartTime = 0;
+    uint32_t _joinTime = 0;
+
+    void ProcessPacket(NetworkPacket& packet);
+    void HandleToken(NetworkPacket& packet);
+    void HandleAuth(NetworkPacket& packet);
+    void HandleObjects(NetworkPacket& packet);
+    void HandleMap(NetworkPacket& packet);
+    void HandleTick(NetworkPacket& packet);
+    void SendCommand(uint32_t command);
+};
+
+#endif // DISABLE_NETWORK
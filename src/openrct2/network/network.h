@@ -82,6 +82,7 @@ std::unique_ptr<GameActionResult> network_modify_groups(
     PermissionState permissionState, bool isExecuting);
 std::unique_ptr<GameActionResult> network_kick_player(NetworkPlayerId_t playerId, bool isExecuting);
 uint8_t network_get_default_group();
+void network_set_default_group(uint8_t id);
 int32_t network_get_num_actions();
 rct_string_id network_get_action_name_string_id(uint32_t index);
 int32_t network_can_perform_action(uint32_t groupindex, uint32_t index);
@@ -112,5 +113,7 @@ const utf8* network_get_server_provider_website();
 std::string network_get_version();
 
 NetworkStats_t network_get_stats();
+// The number of packets that were waiting in the outbound queues when they were last sent.
+uint32_t network_get_flushed_packet_count();
 NetworkServerState_t network_get_server_state();
 json_t* network_get_server_info_as_json();
@@ -9,7 +9,6 @@
 
 #include "ImageTable.h"
 
-#include "../OpenRCT2.h"
 #include "../core/IStream.hpp"
 #include "Object.h"
 
@@ -17,6 +16,59 @@
 #include <memory>
 #include <stdexcept>
 
+// The offset, width, height, x and y offset, flags and zoomed offset of an image as written by Serialise
+static constexpr uint64_t SERIALISED_ELEMENT_SIZE = 4 + 5 * 2 + 4;
+
+/**
+ * Checks that the pixels of an image lie within the image data that follows its offset, so that a damaged cache
+ * entry can not make the sprite drawing code read past the end of the image data.
+ */
+static bool IsImageDataInRange(const rct_g1_element& g1, size_t available)
+{
+    if (g1.width < 0 || g1.height < 0)
+    {
+        return false;
+    }
+    if (g1.flags & G1_FLAG_PALETTE)
+    {
+        return (size_t)g1.width * 3 <= available;
+    }
+    if (!(g1.flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        return (size_t)g1.width * g1.height <= available;
+    }
+
+    // Each row starts at an offset read from a table at the start of the image, it holds runs of pixels until the
+    // run that ends the row.
+    const uint8_t* data = g1.offset;
+    if ((size_t)g1.height * 2 > available)
+    {
+        return false;
+    }
+    for (int32_t row = 0; row < g1.height; row++)
+    {
+        size_t position = data[row * 2] | (data[row * 2 + 1] << 8);
+        bool endOfLine = false;
+        while (!endOfLine)
+        {
+            if (position + 2 > available)
+            {
+                return false;
+            }
+            uint8_t chunk0 = data[position];
+            uint8_t x = data[position + 1];
+            size_t runLength = chunk0 & 0x7F;
+            position += 2 + runLength;
+            if (position > available || x + runLength > (size_t)g1.width)
+            {
+                return false;
+            }
+            endOfLine = (chunk0 & 0x80) != 0;
+        }
+    }
+    return true;
+}
+
 ImageTable::~ImageTable()
 {
     if (_data == nullptr)
@@ -30,7 +82,7 @@ ImageTable::~ImageTable()
 
 void ImageTable::Read(IReadObjectContext* context, IStream* stream)
 {
-    if (gOpenRCT2NoGraphics)
+    if (!context->ShouldLoadImages())
     {
         return;
     }
@@ -97,6 +149,101 @@ void ImageTable::Read(IReadObjectContext* context, IStream* stream)
     }
 }
 
+void ImageTable::Serialise(IStream* stream) const
+{
+    std::vector<uint32_t> dataSizes;
+    uint32_t imageDataSize = 0;
+    for (const auto& entry : _entries)
+    {
+        auto length = entry.offset == nullptr ? 0 : (uint32_t)g1_calculate_data_size(&entry);
+        dataSizes.push_back(length);
+        imageDataSize += length;
+    }
+
+    stream->WriteValue<uint32_t>((uint32_t)_entries.size());
+    stream->WriteValue<uint32_t>(imageDataSize);
+
+    uint32_t imageDataOffset = 0;
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        const auto& g1Element = _entries[i];
+        stream->WriteValue<uint32_t>(g1Element.offset == nullptr ? NULL_IMAGE_DATA_OFFSET : imageDataOffset);
+        stream->WriteValue<int16_t>(g1Element.width);
+        stream->WriteValue<int16_t>(g1Element.height);
+        stream->WriteValue<int16_t>(g1Element.x_offset);
+        stream->WriteValue<int16_t>(g1Element.y_offset);
+        stream->WriteValue<uint16_t>(g1Element.flags);
+        stream->WriteValue<int32_t>(g1Element.zoomed_offset);
+        imageDataOffset += dataSizes[i];
+    }
+
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        if (dataSizes[i] != 0)
+        {
+            stream->Write(_entries[i].offset, dataSizes[i]);
+        }
+    }
+}
+
+/**
+ * Reads an image table written by Serialise. Throws if the data is truncated or any image would lie outside of the
+ * image data, nothing is added to the table in that case.
+ */
+void ImageTable::Deserialise(IStream* stream)
+{
+    uint32_t numImages = stream->ReadValue<uint32_t>();
+    uint32_t imageDataSize = stream->ReadValue<uint32_t>();
+    if (stream->GetLength() - stream->GetPosition() < numImages * SERIALISED_ELEMENT_SIZE + imageDataSize)
+    {
+        throw std::runtime_error("Image table truncated.");
+    }
+
+    auto data = std::make_unique<uint8_t[]>(imageDataSize);
+    uintptr_t imageDataBase = (uintptr_t)data.get();
+    std::vector<rct_g1_element> newEntries;
+    for (uint32_t i = 0; i < numImages; i++)
+    {
+        rct_g1_element g1Element;
+
+        uint32_t imageDataOffset = stream->ReadValue<uint32_t>();
+        if (imageDataOffset == NULL_IMAGE_DATA_OFFSET)
+        {
+            g1Element.offset = nullptr;
+        }
+        else if (imageDataOffset <= imageDataSize)
+        {
+            g1Element.offset = (uint8_t*)(imageDataBase + imageDataOffset);
+        }
+        else
+        {
+            throw std::runtime_error("Image data offset out of range.");
+        }
+
+        g1Element.width = stream->ReadValue<int16_t>();
+        g1Element.height = stream->ReadValue<int16_t>();
+        g1Element.x_offset = stream->ReadValue<int16_t>();
+        g1Element.y_offset = stream->ReadValue<int16_t>();
+        g1Element.flags = stream->ReadValue<uint16_t>();
+        g1Element.zoomed_offset = stream->ReadValue<int32_t>();
+
+        newEntries.push_back(g1Element);
+    }
+    stream->Read(data.get(), imageDataSize);
+
+    for (const auto& g1Element : newEntries)
+    {
+        if (g1Element.offset != nullptr
+            && !IsImageDataInRange(g1Element, imageDataSize - (size_t)(g1Element.offset - data.get())))
+        {
+            throw std::runtime_error("Image data out of range.");
+        }
+    }
+
+    _data = std::move(data);
+    _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+}
+
 void ImageTable::AddImage(const rct_g1_element* g1)
 {
     rct_g1_element newg1 = *g1;
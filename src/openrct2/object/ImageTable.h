@@ -21,6 +21,8 @@ interface IStream;
 class ImageTable
 {
 private:
+    static constexpr uint32_t NULL_IMAGE_DATA_OFFSET = 0xFFFFFFFF;
+
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
 
@@ -31,6 +33,11 @@ public:
     ~ImageTable();
 
     void Read(IReadObjectContext* context, IStream* stream);
+    /**
+     * Writes the entire image table so that it can be restored by Deserialise, e.g. for the object cache.
+     */
+    void Serialise(IStream* stream) const;
+    void Deserialise(IStream* stream);
     const rct_g1_element* GetImages() const
     {
         return _entries.data();
@@ -149,6 +149,8 @@ interface IReadObjectContext
     virtual IObjectRepository& GetObjectRepository() abstract;
     virtual bool ShouldLoadImages() abstract;
     virtual std::vector<uint8_t> GetData(const std::string_view& path) abstract;
+    // The object's image table from the object cache, filled in once the images have been imported if empty.
+    virtual std::vector<uint8_t>* GetCachedImages() abstract;
 
     virtual void LogWarning(uint32_t code, const utf8* text) abstract;
     virtual void LogError(uint32_t code, const utf8* text) abstract;
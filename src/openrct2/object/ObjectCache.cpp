@@ -0,0 +1,183 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectCache.h"
+
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileStream.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "ObjectJsonHelpers.h"
+
+#include <cstdio>
+
+ObjectCache::ObjectCache(const std::string& directory)
+    : _directory(directory)
+{
+}
+
+bool ObjectCache::TryGet(const std::string& path, ObjectCacheEntry& entry) const
+{
+    auto entryPath = GetEntryPath(path);
+    if (!File::Exists(entryPath))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto expectedHeader = GetHeader(path);
+        auto fs = FileStream(entryPath, FILE_MODE_OPEN);
+        auto header = fs.ReadValue<ObjectCacheHeader>();
+        if (header.HeaderSize != sizeof(ObjectCacheHeader) || header.MagicNumber != MAGIC_NUMBER
+            || header.Version != VERSION || header.FileSize != expectedHeader.FileSize
+            || header.FileChecksum != expectedHeader.FileChecksum)
+        {
+            log_verbose("ObjectCache: '%s' out of date", path.c_str());
+            return false;
+        }
+
+        // Entries are named after a checksum of the path, make sure it really is the same object
+        if (fs.ReadStdString() != path)
+        {
+            return false;
+        }
+
+        auto numImageSources = fs.ReadValue<uint32_t>();
+        entry.ImageSources.clear();
+        for (uint32_t i = 0; i < numImageSources; i++)
+        {
+            auto source = fs.ReadStdString();
+            auto stamp = fs.ReadValue<FileStamp>();
+            auto currentStamp = GetImageSourceStamp(source);
+            if (stamp.Size != currentStamp.Size || stamp.DateModified != currentStamp.DateModified
+                || stamp.Checksum != currentStamp.Checksum)
+            {
+                log_verbose("ObjectCache: '%s' out of date, image source '%s' changed", path.c_str(), source.c_str());
+                return false;
+            }
+            entry.ImageSources.push_back(source);
+        }
+
+        auto jsonLength = fs.ReadValue<uint32_t>();
+        entry.Json.resize(jsonLength);
+        fs.Read(entry.Json.data(), jsonLength);
+
+        auto imagesLength = fs.ReadValue<uint32_t>();
+        entry.Images.resize(imagesLength);
+        fs.Read(entry.Images.data(), imagesLength);
+        return !entry.Json.empty() && !entry.Images.empty();
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("ObjectCache: unable to read '%s': %s", entryPath.c_str(), e.what());
+        return false;
+    }
+}
+
+void ObjectCache::Set(const std::string& path, const ObjectCacheEntry& entry) const
+{
+    // Without the images there is nothing worth caching, reading the JSON alone is cheap
+    if (entry.Json.empty() || entry.Images.empty())
+    {
+        return;
+    }
+
+    auto entryPath = GetEntryPath(path);
+    try
+    {
+        auto header = GetHeader(path);
+        Path::CreateDirectory(_directory);
+        auto fs = FileStream(entryPath, FILE_MODE_WRITE);
+        fs.WriteValue(header);
+        fs.WriteString(path);
+        fs.WriteValue<uint32_t>((uint32_t)entry.ImageSources.size());
+        for (const auto& source : entry.ImageSources)
+        {
+            fs.WriteString(source);
+            fs.WriteValue(GetImageSourceStamp(source));
+        }
+        fs.WriteValue<uint32_t>((uint32_t)entry.Json.size());
+        fs.Write(entry.Json.data(), entry.Json.size());
+        fs.WriteValue<uint32_t>((uint32_t)entry.Images.size());
+        fs.Write(entry.Images.data(), entry.Images.size());
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write object cache: '%s'.", entryPath.c_str());
+        Console::Error::WriteLine("%s", e.what());
+    }
+}
+
+/**
+ * Drops the entry of an object, e.g. when it could not be read back.
+ */
+void ObjectCache::Remove(const std::string& path) const
+{
+    auto entryPath = GetEntryPath(path);
+    if (File::Exists(entryPath))
+    {
+        File::Delete(entryPath);
+    }
+}
+
+std::string ObjectCache::GetEntryPath(const std::string& path) const
+{
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "%016llx.cache", (unsigned long long)GetChecksum(path.data(), path.size()));
+    return Path::Combine(_directory, fileName);
+}
+
+uint64_t ObjectCache::GetChecksum(const void* data, size_t length)
+{
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    auto bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+uint64_t ObjectCache::GetFileChecksum(const std::string& path)
+{
+    auto data = File::ReadAllBytes(path);
+    return GetChecksum(data.data(), data.size());
+}
+
+ObjectCache::ObjectCacheHeader ObjectCache::GetHeader(const std::string& path)
+{
+    ObjectCacheHeader header;
+    header.FileSize = FileStream(path, FILE_MODE_OPEN).GetLength();
+    header.FileChecksum = GetFileChecksum(path);
+    return header;
+}
+
+ObjectCache::FileStamp ObjectCache::GetImageSourceStamp(const std::string& source)
+{
+    // Sources that are not available are stamped as empty, so that installing them later invalidates the entry
+    FileStamp stamp;
+    auto path = ObjectJsonHelpers::GetImageSourcePath(source);
+    if (!path.empty() && File::Exists(path))
+    {
+        stamp.Size = FileStream(path, FILE_MODE_OPEN).GetLength();
+        if (String::StartsWith(source, "$"))
+        {
+            stamp.DateModified = File::GetLastModified(path);
+        }
+        else
+        {
+            stamp.Checksum = GetFileChecksum(path);
+        }
+    }
+    return stamp;
+}
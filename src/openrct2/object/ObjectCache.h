@@ -0,0 +1,71 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+#include <vector>
+
+struct ObjectCacheEntry
+{
+    // The object's JSON, so that a .parkobj does not need to be opened again.
+    std::vector<uint8_t> Json;
+    // The object's image table after all images have been imported, as written by ImageTable::Serialise.
+    std::vector<uint8_t> Images;
+    // Where the images were imported from besides the object's own file, see ObjectJsonHelpers::GetImageSources.
+    std::vector<std::string> ImageSources;
+};
+
+/**
+ * A cache of JSON objects that have already been read, holding one file per object. Entries are named after
+ * the object's path and only used while the object's file and the image files next to it still have the same
+ * contents. The game's own data files that images are taken from, g1.dat, CSG and legacy objects, are too large
+ * to read every time and are compared by size and modification time instead. A source that was missing, e.g. CSG
+ * before RCT1 was set up, invalidates the entry once it becomes available.
+ */
+class ObjectCache final
+{
+private:
+    static constexpr uint32_t MAGIC_NUMBER = 0x4843424F; // OBCH
+    static constexpr uint16_t VERSION = 3;
+
+    struct ObjectCacheHeader
+    {
+        uint32_t HeaderSize = sizeof(ObjectCacheHeader);
+        uint32_t MagicNumber = MAGIC_NUMBER;
+        uint16_t Version = VERSION;
+        uint64_t FileSize = 0;
+        uint64_t FileChecksum = 0;
+    };
+
+    struct FileStamp
+    {
+        uint64_t Size = 0;
+        uint64_t DateModified = 0;
+        uint64_t Checksum = 0;
+    };
+
+    std::string _directory;
+
+public:
+    explicit ObjectCache(const std::string& directory);
+
+    bool TryGet(const std::string& path, ObjectCacheEntry& entry) const;
+    void Set(const std::string& path, const ObjectCacheEntry& entry) const;
+    void Remove(const std::string& path) const;
+
+private:
+    std::string GetEntryPath(const std::string& path) const;
+    static uint64_t GetChecksum(const void* data, size_t length);
+    static uint64_t GetFileChecksum(const std::string& path);
+    static ObjectCacheHeader GetHeader(const std::string& path);
+    static FileStamp GetImageSourceStamp(const std::string& source);
+};
@@ -15,6 +15,7 @@
 #include "../core/FileStream.hpp"
 #include "../core/Json.hpp"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -26,6 +27,8 @@
 #include "FootpathObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
+#include "ObjectCache.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectLimits.h"
 #include "ObjectList.h"
 #include "RideObject.h"
@@ -89,6 +92,7 @@ private:
 
     std::string _objectName;
     bool _loadImages;
+    std::vector<uint8_t>* _cachedImages = nullptr;
     std::string _basePath;
     bool _wasWarning = false;
     bool _wasError = false;
@@ -132,6 +136,16 @@ public:
         return {};
     }
 
+    std::vector<uint8_t>* GetCachedImages() override
+    {
+        return _cachedImages;
+    }
+
+    void SetCachedImages(std::vector<uint8_t>* cachedImages)
+    {
+        _cachedImages = cachedImages;
+    }
+
     void LogWarning(uint32_t code, const utf8* text) override
     {
         _wasWarning = true;
@@ -156,7 +170,8 @@ public:
 namespace ObjectFactory
 {
     static Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever);
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever, bool loadImages,
+        std::vector<uint8_t>* cachedImages);
 
     static uint8_t ParseSourceGame(const std::string& s)
     {
@@ -191,7 +206,23 @@ namespace ObjectFactory
         }
     }
 
-    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path)
+    /**
+     * Maps an object file whose chunk is stored without any encoding, so it can be read in place.
+     */
+    static std::unique_ptr<MemoryMappedFile> MapUnencodedObjectFile(const utf8* path)
+    {
+        try
+        {
+            return std::make_unique<MemoryMappedFile>(path);
+        }
+        catch (const IOException& e)
+        {
+            log_verbose("Unable to map %s: %s", path, e.what());
+        }
+        return nullptr;
+    }
+
+    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages)
     {
         log_verbose("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
@@ -211,11 +242,42 @@ namespace ObjectFactory
                 object_entry_get_name_fixed(objectName, sizeof(objectName), &entry);
                 log_verbose("  entry: { 0x%08X, \"%s\", 0x%08X }", entry.flags, objectName, entry.checksum);
 
-                auto chunk = chunkReader.ReadChunk();
-                log_verbose("  size: %zu", chunk->GetLength());
+                auto readContext = ReadObjectContext(
+                    objectRepository, objectName, loadImages && !gOpenRCT2NoGraphics, nullptr);
 
-                auto chunkStream = MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+                // Objects without any encoding can be read straight from the file rather than being copied into a
+                // chunk first. The mapping only lives for the load, the image table copies the pixel data out of it.
+                auto chunkPosition = fs.GetPosition();
+                auto header = fs.ReadValue<sawyercoding_chunk_header>();
+                fs.SetPosition(chunkPosition);
+
+                std::unique_ptr<MemoryMappedFile> mappedFile;
+                if (header.encoding == CHUNK_ENCODING_NONE && readContext.ShouldLoadImages())
+                {
+                    mappedFile = MapUnencodedObjectFile(path);
+                }
+
+                std::shared_ptr<SawyerChunk> chunk;
+                const void* chunkData;
+                size_t chunkLength;
+                if (mappedFile != nullptr)
+                {
+                    uint64_t dataPosition = chunkPosition + sizeof(header);
+                    uint64_t remainingLength = mappedFile->GetLength() > dataPosition ? mappedFile->GetLength() - dataPosition
+                                                                                       : 0;
+                    SawyerChunkReader::ValidateUnencodedChunkHeader(header, remainingLength);
+                    chunkData = mappedFile->GetData() + dataPosition;
+                    chunkLength = header.length;
+                }
+                else
+                {
+                    chunk = chunkReader.ReadChunk();
+                    chunkData = chunk->GetData();
+                    chunkLength = chunk->GetLength();
+                }
+                log_verbose("  size: %zu", chunkLength);
+
+                auto chunkStream = MemoryStream(chunkData, chunkLength);
                 ReadObjectLegacy(result, &readContext, &chunkStream);
                 if (readContext.WasError())
                 {
@@ -347,11 +409,56 @@ namespace ObjectFactory
         return 0xFF;
     }
 
-    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path)
+    static json_t* ParseJson(const std::vector<uint8_t>& jsonBytes)
+    {
+        json_error_t jsonLoadError;
+        auto jRoot = json_loadb((const char*)jsonBytes.data(), jsonBytes.size(), 0, &jsonLoadError);
+        if (jRoot == nullptr)
+        {
+            throw JsonException(&jsonLoadError);
+        }
+        return jRoot;
+    }
+
+    /**
+     * Creates the object from an object cache entry, which holds everything needed to read the object
+     * without opening its file.
+     */
+    static Object* CreateObjectFromCache(
+        IObjectRepository& objectRepository, const std::string& path, ObjectCacheEntry& cacheEntry, bool loadImages)
+    {
+        try
+        {
+            auto jRoot = ParseJson(cacheEntry.Json);
+            auto obj = CreateObjectFromJson(objectRepository, jRoot, nullptr, loadImages, &cacheEntry.Images);
+            json_decref(jRoot);
+            return obj;
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to read '%s' from object cache: %s", path.c_str(), e.what());
+            return nullptr;
+        }
+    }
+
+    Object* CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, const std::string_view& path, bool loadImages, const ObjectCache* cache)
     {
         Object* result = nullptr;
         try
         {
+            ObjectCacheEntry cacheEntry;
+            if (cache != nullptr && cache->TryGet(std::string(path), cacheEntry))
+            {
+                result = CreateObjectFromCache(objectRepository, std::string(path), cacheEntry, loadImages);
+                if (result != nullptr)
+                {
+                    return result;
+                }
+                cache->Remove(std::string(path));
+                cacheEntry = {};
+            }
+
             auto archive = Zip::Open(path, ZIP_ACCESS::READ);
             auto jsonBytes = archive->GetFileData("object.json");
             if (jsonBytes.empty())
@@ -359,15 +466,23 @@ namespace ObjectFactory
                 throw std::runtime_error("Unable to open object.json.");
             }
 
-            json_error_t jsonLoadError;
-            auto jRoot = json_loadb((const char*)jsonBytes.data(), jsonBytes.size(), 0, &jsonLoadError);
-            if (jRoot == nullptr)
+            auto jRoot = ParseJson(jsonBytes);
+            auto fileDataRetriever = ZipDataRetriever(*archive);
+            Object* obj = CreateObjectFromJson(
+                objectRepository, jRoot, &fileDataRetriever, loadImages, cache != nullptr ? &cacheEntry.Images : nullptr);
+            if (obj != nullptr && cache != nullptr)
             {
-                throw JsonException(&jsonLoadError);
+                // Image files are read from the archive itself, which the cache already checks
+                for (const auto& source : ObjectJsonHelpers::GetImageSources(jRoot))
+                {
+                    if (String::StartsWith(source, "$"))
+                    {
+                        cacheEntry.ImageSources.push_back(source);
+                    }
+                }
+                cacheEntry.Json = std::move(jsonBytes);
+                cache->Set(std::string(path), cacheEntry);
             }
-
-            auto fileDataRetriever = ZipDataRetriever(*archive);
-            Object* obj = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
             json_decref(jRoot);
             return obj;
         }
@@ -381,16 +496,41 @@ namespace ObjectFactory
         return result;
     }
 
-    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path)
+    Object* CreateObjectFromJsonFile(
+        IObjectRepository& objectRepository, const std::string& path, bool loadImages, const ObjectCache* cache)
     {
         log_verbose("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
         Object* result = nullptr;
         try
         {
-            auto jRoot = Json::ReadFromFile(path.c_str());
+            ObjectCacheEntry cacheEntry;
+            if (cache != nullptr && cache->TryGet(path, cacheEntry))
+            {
+                result = CreateObjectFromCache(objectRepository, path, cacheEntry, loadImages);
+                if (result != nullptr)
+                {
+                    return result;
+                }
+                cache->Remove(path);
+                cacheEntry = {};
+            }
+
+            auto jsonBytes = File::ReadAllBytes(path);
+            auto jRoot = ParseJson(jsonBytes);
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            result = CreateObjectFromJson(
+                objectRepository, jRoot, &fileDataRetriever, loadImages, cache != nullptr ? &cacheEntry.Images : nullptr);
+            if (result != nullptr && cache != nullptr)
+            {
+                for (const auto& source : ObjectJsonHelpers::GetImageSources(jRoot))
+                {
+                    cacheEntry.ImageSources.push_back(
+                        String::StartsWith(source, "$") ? source : Path::Combine(Path::GetDirectory(path), source));
+                }
+                cacheEntry.Json = std::move(jsonBytes);
+                cache->Set(path, cacheEntry);
+            }
             json_decref(jRoot);
         }
         catch (const std::runtime_error& err)
@@ -404,7 +544,8 @@ namespace ObjectFactory
     }
 
     Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever)
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever, bool loadImages,
+        std::vector<uint8_t>* cachedImages)
     {
         log_verbose("CreateObjectFromJson(...)");
 
@@ -430,7 +571,8 @@ namespace ObjectFactory
                 std::memcpy(entry.name, originalName.c_str(), minLength);
 
                 result = CreateObject(entry);
-                auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever);
+                auto readContext = ReadObjectContext(objectRepository, id, loadImages && !gOpenRCT2NoGraphics, fileRetriever);
+                readContext.SetCachedImages(cachedImages);
                 result->ReadJson(&readContext, jRoot);
                 if (readContext.WasError())
                 {
@@ -16,6 +16,7 @@
 #include "../core/File.h"
 #include "../core/FileScanner.h"
 #include "../core/Memory.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -459,6 +460,62 @@ namespace ObjectJsonHelpers
         return result;
     }
 
+    std::vector<std::string> GetImageSources(const json_t* root)
+    {
+        std::vector<std::string> sources;
+        auto jsonImages = json_object_get(root, "images");
+        size_t i;
+        json_t* el;
+        json_array_foreach(jsonImages, i, el)
+        {
+            std::string source;
+            if (json_is_string(el))
+            {
+                source = json_string_value(el);
+                if (String::StartsWith(source, "$CSG"))
+                {
+                    source = "$CSG";
+                }
+                else if (String::StartsWith(source, "$G1"))
+                {
+                    source = "$G1";
+                }
+                else if (String::StartsWith(source, "$RCT2:OBJDATA/"))
+                {
+                    source = source.substr(0, source.find('['));
+                }
+            }
+            else if (json_is_object(el))
+            {
+                source = GetString(el, "path");
+            }
+            if (!source.empty() && std::find(sources.begin(), sources.end(), source) == sources.end())
+            {
+                sources.push_back(source);
+            }
+        }
+        return sources;
+    }
+
+    std::string GetImageSourcePath(const std::string& source)
+    {
+        if (source == "$CSG")
+        {
+            return is_csg_loaded() ? gfx_get_csg_data_path() : std::string();
+        }
+        if (source == "$G1")
+        {
+            const auto env = GetContext()->GetPlatformEnvironment();
+            return Path::Combine(env->GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
+        }
+        if (String::StartsWith(source, "$RCT2:OBJDATA/"))
+        {
+            auto objectPath = FindLegacyObject(source.substr(14));
+            return File::Exists(objectPath) ? objectPath : std::string();
+        }
+        return source;
+    }
+
     static uint8_t ParseStringId(const std::string& s)
     {
         if (s == "name")
@@ -502,6 +559,15 @@ namespace ObjectJsonHelpers
     {
         if (context->ShouldLoadImages())
         {
+            // Restore the images from the object cache if they have been imported before
+            auto cachedImages = context->GetCachedImages();
+            if (cachedImages != nullptr && !cachedImages->empty() && imageTable.GetCount() == 0)
+            {
+                auto stream = MemoryStream(cachedImages->data(), cachedImages->size());
+                imageTable.Deserialise(&stream);
+                return;
+            }
+
             // First gather all the required images from inspecting the JSON
             std::vector<std::unique_ptr<RequiredImage>> allImages;
             auto jsonImages = json_object_get(root, "images");
@@ -558,6 +624,14 @@ namespace ObjectJsonHelpers
                     }
                 }
             }
+
+            if (cachedImages != nullptr && imageTable.GetCount() != 0)
+            {
+                MemoryStream stream;
+                imageTable.Serialise(&stream);
+                auto data = (const uint8_t*)stream.GetData();
+                cachedImages->assign(data, data + stream.GetLength());
+            }
         }
     }
 } // namespace ObjectJsonHelpers
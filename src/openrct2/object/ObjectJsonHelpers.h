@@ -36,6 +36,15 @@ namespace ObjectJsonHelpers
     rct_object_entry ParseObjectEntry(const std::string& s);
     void LoadStrings(const json_t* root, StringTable& stringTable);
     void LoadImages(IReadObjectContext* context, const json_t* root, ImageTable& imageTable);
+    /**
+     * Gets the sources of the object's images besides the object itself, e.g. "$CSG" or "$RCT2:OBJDATA/NAME.DAT".
+     * Image files are returned as their path relative to the object.
+     */
+    std::vector<std::string> GetImageSources(const json_t* root);
+    /**
+     * Gets the file an image source of GetImageSources is read from, or an empty string if it is not available.
+     */
+    std::string GetImageSourcePath(const std::string& source);
 
     template<typename T> static T GetFlags(const json_t* obj, std::initializer_list<std::pair<std::string, T>> list)
     {
@@ -32,6 +32,7 @@
 #include "../util/SawyerCoding.h"
 #include "../util/Util.h"
 #include "Object.h"
+#include "ObjectCache.h"
 #include "ObjectFactory.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
@@ -91,19 +92,20 @@ public:
 public:
     std::tuple<bool, ObjectRepositoryItem> Create([[maybe_unused]] int32_t language, const std::string& path) const override
     {
+        // Nothing in the index depends on images, so skip reading them.
         Object* object = nullptr;
         auto extension = Path::GetExtension(path);
         if (String::Equals(extension, ".json", true))
         {
-            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, false);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, false);
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str());
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), false);
         }
         if (object != nullptr)
         {
@@ -209,6 +211,7 @@ class ObjectRepository final : public IObjectRepository
 {
     std::shared_ptr<IPlatformEnvironment> const _env;
     ObjectFileIndex const _fileIndex;
+    ObjectCache const _objectCache;
     std::vector<ObjectRepositoryItem> _items;
     ObjectEntryMap _itemMap;
 
@@ -216,6 +219,7 @@ public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
         , _fileIndex(*this, *env)
+        , _objectCache(env->GetDirectoryPath(DIRBASE::CACHE, DIRID::CACHE_OBJECT))
     {
     }
 
@@ -281,11 +285,11 @@ public:
         auto extension = Path::GetExtension(ori->Path);
         if (String::Equals(extension, ".json", true))
         {
-            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, true, &_objectCache);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path);
+            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, true, &_objectCache);
         }
         else
         {
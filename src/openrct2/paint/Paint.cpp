@@ -12,10 +12,12 @@
 #include "../Context.h"
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
+#include "../drawing/FrameProfiler.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
 #include "../paint/Painter.h"
+#include "TilePaintCache.h"
 #include "sprite/Paint.Sprite.h"
 #include "tile_element/Paint.TileElement.h"
 
@@ -421,6 +423,7 @@ paint_struct* paint_arrange_structs_helper(paint_struct* ps_next, uint16_t quadr
  */
 void paint_session_arrange(paint_session* session)
 {
+    FrameProfilerScope profilerScope(FRAME_PROFILER_SECTION_ARRANGE);
     paint_struct* psHead = &session->PaintHead;
 
     paint_struct* ps = psHead;
@@ -727,6 +730,13 @@ paint_struct* sub_98196C(
     assert((uint16_t)bound_box_length_x == (int16_t)bound_box_length_x);
     assert((uint16_t)bound_box_length_y == (int16_t)bound_box_length_y);
 
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_98196C, image_id,
+            { x_offset, y_offset, bound_box_length_x, bound_box_length_y, bound_box_length_z, z_offset, 0, 0, 0 });
+    }
+
     session->LastRootPS = nullptr;
     session->UnkF1AD2C = nullptr;
 
@@ -875,6 +885,14 @@ paint_struct* sub_98197C(
     int16_t bound_box_length_y, int8_t bound_box_length_z, int16_t z_offset, int16_t bound_box_offset_x,
     int16_t bound_box_offset_y, int16_t bound_box_offset_z)
 {
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_98197C, image_id,
+            { x_offset, y_offset, bound_box_length_x, bound_box_length_y, bound_box_length_z, z_offset, bound_box_offset_x,
+                bound_box_offset_y, bound_box_offset_z });
+    }
+
     session->LastRootPS = nullptr;
     session->UnkF1AD2C = nullptr;
 
@@ -935,6 +953,14 @@ paint_struct* sub_98198C(
     assert((uint16_t)bound_box_length_x == bound_box_length_x);
     assert((uint16_t)bound_box_length_y == bound_box_length_y);
 
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_98198C, image_id,
+            { x_offset, y_offset, bound_box_length_x, bound_box_length_y, bound_box_length_z, z_offset, bound_box_offset_x,
+                bound_box_offset_y, bound_box_offset_z });
+    }
+
     session->LastRootPS = nullptr;
     session->UnkF1AD2C = nullptr;
 
@@ -977,6 +1003,14 @@ paint_struct* sub_98199C(
     assert((uint16_t)bound_box_length_x == (int16_t)bound_box_length_x);
     assert((uint16_t)bound_box_length_y == (int16_t)bound_box_length_y);
 
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_98199C, image_id,
+            { x_offset, y_offset, bound_box_length_x, bound_box_length_y, bound_box_length_z, z_offset, bound_box_offset_x,
+                bound_box_offset_y, bound_box_offset_z });
+    }
+
     if (session->LastRootPS == nullptr)
     {
         return sub_98197C(
@@ -1012,6 +1046,12 @@ paint_struct* sub_98199C(
  */
 bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id, uint16_t x, uint16_t y)
 {
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_ATTACH_TO_PREVIOUS_ATTACH, image_id, { (int16_t)x, (int16_t)y, 0, 0, 0, 0, 0, 0, 0 });
+    }
+
     if (session->UnkF1AD2C == nullptr)
     {
         return paint_attach_to_previous_ps(session, image_id, x, y);
@@ -1049,6 +1089,12 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
  */
 bool paint_attach_to_previous_ps(paint_session* session, uint32_t image_id, uint16_t x, uint16_t y)
 {
+    if (session->TileRecorder != nullptr)
+    {
+        tile_paint_cache_record(
+            session, TILE_PAINT_OP_ATTACH_TO_PREVIOUS_PS, image_id, { (int16_t)x, (int16_t)y, 0, 0, 0, 0, 0, 0, 0 });
+    }
+
     if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
     {
         return false;
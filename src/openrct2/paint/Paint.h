@@ -15,6 +15,7 @@
 #include "../world/Location.hpp"
 
 struct TileElement;
+struct TilePaintRecorder;
 
 #pragma pack(push, 1)
 /* size 0x12 */
@@ -172,6 +173,8 @@ struct paint_session
     uint8_t Unk141E9DB;
     uint16_t WaterHeight;
     uint32_t TrackColours[4];
+    // Set while the elements of a tile are painted into a scratch session to be cached, see TilePaintCache.h
+    TilePaintRecorder* TileRecorder;
 };
 
 extern paint_session gPaintSession;
@@ -15,11 +15,13 @@
 #include "../ReplayManager.h"
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
+#include "../drawing/FrameProfiler.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Language.h"
+#include "../localisation/Localisation.h"
 #include "../paint/Paint.h"
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
@@ -76,6 +78,10 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(dpi);
     }
+    if (frame_profiler_is_visible())
+    {
+        PaintFrameProfiler(dpi);
+    }
     gCurrentDrawCount++;
 }
 
@@ -129,6 +135,44 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
     gfx_set_dirty_blocks(x - 16, y - 4, gLastDrawStringX + 16, 16);
 }
 
+void Painter::PaintFrameProfiler(rct_drawpixelinfo* dpi)
+{
+    int32_t x = 8;
+    int32_t y = 40;
+    int32_t right = x;
+
+    utf8 buffer[128] = { 0 };
+    utf8* ch = buffer;
+    ch = utf8_write_codepoint(ch, FORMAT_SMALLFONT);
+    ch = utf8_write_codepoint(ch, FORMAT_OUTLINE);
+    ch = utf8_write_codepoint(ch, FORMAT_WHITE);
+    const size_t prefixLength = ch - buffer;
+
+    format_string(ch, sizeof(buffer) - prefixLength, STR_FRAME_PROFILER_HEADER, nullptr);
+    gfx_draw_string(dpi, buffer, 0, x, y);
+    right = std::max(right, gLastDrawStringX);
+
+    for (int32_t i = 0; i < FRAME_PROFILER_SECTION_COUNT; i++)
+    {
+        auto section = static_cast<FRAME_PROFILER_SECTION>(i);
+        auto stats = frame_profiler_get_stats(section);
+
+        // The times are shown in hundredths of a millisecond
+        uint8_t args[14];
+        set_format_arg_on(args, 0, rct_string_id, frame_profiler_get_section_string_id(section));
+        set_format_arg_on(args, 2, int32_t, static_cast<int32_t>(stats.Last * 100));
+        set_format_arg_on(args, 6, int32_t, static_cast<int32_t>(stats.Average * 100));
+        set_format_arg_on(args, 10, int32_t, static_cast<int32_t>(stats.Max * 100));
+        format_string(ch, sizeof(buffer) - prefixLength, STR_FRAME_PROFILER_SECTION_TIMES, args);
+        y += 10;
+        gfx_draw_string(dpi, buffer, 0, x, y);
+        right = std::max(right, gLastDrawStringX);
+    }
+
+    // Make area dirty so the text doesn't get drawn over the last
+    gfx_set_dirty_blocks(x - 4, 36, right + 4, y + 14);
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
@@ -179,6 +223,7 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     session->WoodenSupportsPrependTo = nullptr;
     session->CurrentlyDrawnItem = nullptr;
     session->SurfaceElement = nullptr;
+    session->TileRecorder = nullptr;
 
     return session;
 }
@@ -52,6 +52,7 @@ namespace OpenRCT2
         private:
             void PaintReplayNotice(rct_drawpixelinfo * dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo * dpi);
+            void PaintFrameProfiler(rct_drawpixelinfo * dpi);
             void MeasureFPS();
         };
     } // namespace Paint
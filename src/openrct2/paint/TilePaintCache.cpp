@@ -0,0 +1,737 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TilePaintCache.h"
+
+#include "../Cheats.h"
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../peep/Staff.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Map.h"
+#include "../world/Sprite.h"
+#include "Paint.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Once the recorded tiles take up more memory than this, the least recently painted ones are dropped
+static constexpr size_t TILE_PAINT_CACHE_MAX_SIZE = 32 * 1024 * 1024;
+static constexpr size_t TILE_PAINT_CACHE_SHARD_COUNT = 16;
+
+struct TilePaintOp
+{
+    TILE_PAINT_OP Type;
+    uint8_t InteractionType;
+    // The element being painted, as an index from the first element of the tile, -1 for none.
+    int16_t ElementIndex;
+    // For TILE_PAINT_OP_SET_LAST_ROOT, the op after which LastRootPS had the restored value, -1 for before the tile.
+    int16_t LastRootOp;
+    // Whether the call created a paint struct, and the fields of that paint struct once the tile was painted as the
+    // painters may change them after the call.
+    bool Created;
+    uint8_t FinalFlags;
+    uint32_t FinalImageId;
+    uint32_t FinalColour;
+    uint32_t ImageId;
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    TilePaintOpArgs Args;
+};
+
+struct TilePaintRecord
+{
+    // Set when the tile has to be painted from its elements every time, the ops are then not kept.
+    bool Volatile = false;
+    bool Result = false;
+
+    // What the tile was painted from.
+    std::vector<TileElement> Elements;
+    TileElement Neighbours[4];
+    bool HasNeighbour[4];
+
+    std::vector<TilePaintOp> Ops;
+
+    // The state the elements left the session in.
+    support_height SupportSegments[9];
+    support_height Support;
+    tunnel_entry LeftTunnels[TUNNEL_MAX_COUNT];
+    uint8_t LeftTunnelCount;
+    tunnel_entry RightTunnels[TUNNEL_MAX_COUNT];
+    uint8_t RightTunnelCount;
+    uint8_t VerticalTunnelHeight;
+    bool DidPassSurface;
+    uint8_t Unk141E9DB;
+    uint16_t WaterHeight;
+    uint8_t InteractionType;
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    int16_t DrawnItemIndex;
+    int16_t SurfaceElementIndex;
+    int16_t PathElementIndex;
+    int16_t TrackElementIndex;
+};
+
+struct TilePaintRecorder
+{
+    TilePaintRecord* Record;
+    const TileElement* FirstElement;
+
+    // The op being recorded. It is finished when the next op starts, or the tile ends, as that is when all the
+    // paint structs it created are known.
+    paint_entry* OpStart = nullptr;
+    paint_struct* OpLastRoot = nullptr;
+    bool OpRootFromTileStart = true;
+    // Set when the op calls another paint function that must not be recorded on its own.
+    bool SkipNextOp = false;
+
+    // Whether session->UnkF1AD2C may still be what it was before the tile.
+    bool AttachFromTileStart = true;
+
+    // For each op, the paint struct it created, session->LastRootPS after it and whether that may still be what it
+    // was before the tile.
+    std::vector<paint_entry*> Created;
+    std::vector<paint_struct*> LastRootAfter;
+    std::vector<bool> RootFromTileStartAfter;
+};
+
+struct TilePaintCacheEntry
+{
+    uint64_t Key;
+    size_t Size;
+    std::shared_ptr<const TilePaintRecord> Record;
+};
+
+// Tiles are painted by the paint job threads, the cache is split by tile so that they only wait for each other when
+// they look up tiles of the same shard at the same time.
+struct TilePaintCacheShard
+{
+    std::mutex Mutex;
+    std::list<TilePaintCacheEntry> Entries;
+    std::unordered_map<uint64_t, std::list<TilePaintCacheEntry>::iterator> Map;
+    size_t Size = 0;
+};
+static std::array<TilePaintCacheShard, TILE_PAINT_CACHE_SHARD_COUNT> _tilePaintCacheShards;
+
+static std::atomic<bool> _tilePaintCacheEnabled{ false };
+
+struct TilePaintCacheState
+{
+    int16_t MapSizeUnits;
+    int16_t MapBaseZ;
+    uint8_t ClipHeight;
+    LocationXY8 ClipSelectionA;
+    LocationXY8 ClipSelectionB;
+    bool LandscapeSmoothing;
+
+    bool operator==(const TilePaintCacheState& other) const
+    {
+        return MapSizeUnits == other.MapSizeUnits && MapBaseZ == other.MapBaseZ && ClipHeight == other.ClipHeight
+            && ClipSelectionA.xy == other.ClipSelectionA.xy && ClipSelectionB.xy == other.ClipSelectionB.xy
+            && LandscapeSmoothing == other.LandscapeSmoothing;
+    }
+};
+static TilePaintCacheState _tilePaintCacheState = {};
+
+/**
+ * Checks the global state the painters depend on, must be called on the main thread before the frame is painted.
+ */
+void tile_paint_cache_update()
+{
+    // Tools and overlays that highlight tiles change what they look like without changing their elements
+    bool enabled = gMapSelectFlags == 0 && gStaffDrawPatrolAreas == SPRITE_INDEX_NULL && !gTrackDesignSaveMode
+        && !gPaintWidePathsAsGhost && !gPaintBlockedTiles && !gCheatsSandboxMode && !(gScreenFlags & SCREEN_FLAGS_EDITOR);
+    _tilePaintCacheEnabled = enabled;
+
+    TilePaintCacheState state;
+    state.MapSizeUnits = gMapSizeUnits;
+    state.MapBaseZ = gMapBaseZ;
+    state.ClipHeight = gClipHeight;
+    state.ClipSelectionA = gClipSelectionA;
+    state.ClipSelectionB = gClipSelectionB;
+    state.LandscapeSmoothing = gConfigGeneral.landscape_smoothing;
+    if (!(state == _tilePaintCacheState))
+    {
+        _tilePaintCacheState = state;
+        tile_paint_cache_clear();
+    }
+}
+
+void tile_paint_cache_clear()
+{
+    for (auto& shard : _tilePaintCacheShards)
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        shard.Entries.clear();
+        shard.Map.clear();
+        shard.Size = 0;
+    }
+}
+
+static uint64_t tile_paint_cache_get_key(const paint_session* session)
+{
+    return ((uint64_t)session->ViewFlags << 32) | ((uint64_t)session->DPI.zoom_level << 24)
+        | ((uint64_t)session->CurrentRotation << 16) | ((uint64_t)(session->MapPosition.x / 32) << 8)
+        | (uint64_t)(session->MapPosition.y / 32);
+}
+
+static TilePaintCacheShard& tile_paint_cache_get_shard(uint64_t key)
+{
+    // Tiles next to each other are in different shards
+    return _tilePaintCacheShards[(key ^ (key >> 8)) % TILE_PAINT_CACHE_SHARD_COUNT];
+}
+
+static size_t tile_paint_cache_count_elements(const TileElement* firstElement)
+{
+    const TileElement* element = firstElement;
+    while (!(element++)->IsLastForTile())
+    {
+    }
+    return element - firstElement;
+}
+
+/**
+ * Gets the surface of a tile next to the painted one, surfaces are painted with edges that depend on them.
+ */
+static const TileElement* tile_paint_cache_get_neighbour(const CoordsXY& mapPosition, int32_t index)
+{
+    static constexpr const CoordsXY NeighbourOffsets[] = { { -32, 0 }, { 0, 32 }, { 32, 0 }, { 0, -32 } };
+
+    CoordsXY position = { mapPosition.x + NeighbourOffsets[index].x, mapPosition.y + NeighbourOffsets[index].y };
+    if (position.x > 0x2000 || position.y > 0x2000)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const TileElement*>(map_get_surface_element_at(position));
+}
+
+static bool tile_paint_cache_is_valid(
+    const TilePaintRecord& record, const TileElement* firstElement, const CoordsXY& mapPosition)
+{
+    size_t numElements = tile_paint_cache_count_elements(firstElement);
+    if (numElements != record.Elements.size()
+        || std::memcmp(firstElement, record.Elements.data(), numElements * sizeof(TileElement)) != 0)
+    {
+        return false;
+    }
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const TileElement* neighbour = tile_paint_cache_get_neighbour(mapPosition, i);
+        if ((neighbour != nullptr) != record.HasNeighbour[i])
+        {
+            return false;
+        }
+        if (neighbour != nullptr && std::memcmp(neighbour, &record.Neighbours[i], sizeof(TileElement)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int16_t tile_paint_cache_get_element_index(TilePaintRecorder& recorder, const void* element)
+{
+    if (element == nullptr)
+    {
+        return -1;
+    }
+
+    auto index = static_cast<const TileElement*>(element) - recorder.FirstElement;
+    if (index < 0 || index >= (ptrdiff_t)recorder.Record->Elements.size())
+    {
+        // Something from outside the tile, can not be replayed
+        recorder.Record->Volatile = true;
+        return -1;
+    }
+    return (int16_t)index;
+}
+
+static TileElement* tile_paint_cache_get_element(TileElement* firstElement, int16_t index)
+{
+    return index < 0 ? nullptr : firstElement + index;
+}
+
+static void tile_paint_cache_finish_op(paint_session* session, TilePaintRecorder& recorder)
+{
+    if (recorder.OpStart == nullptr)
+    {
+        return;
+    }
+
+    const auto& op = recorder.Record->Ops.back();
+    paint_entry* created = session->NextFreePaintStruct != recorder.OpStart ? recorder.OpStart : nullptr;
+    paint_struct* lastRoot = recorder.OpLastRoot;
+    bool rootFromTileStart = recorder.OpRootFromTileStart;
+    switch (op.Type)
+    {
+        case TILE_PAINT_OP_98196C:
+        case TILE_PAINT_OP_98197C:
+        case TILE_PAINT_OP_98198C:
+            lastRoot = created != nullptr ? &created->basic : nullptr;
+            rootFromTileStart = false;
+            recorder.AttachFromTileStart = false;
+            break;
+        case TILE_PAINT_OP_98199C:
+            if (recorder.OpLastRoot == nullptr)
+            {
+                // Painted as TILE_PAINT_OP_98197C
+                lastRoot = nullptr;
+                rootFromTileStart = false;
+                recorder.AttachFromTileStart = false;
+            }
+            if (created != nullptr)
+            {
+                lastRoot = &created->basic;
+                rootFromTileStart = false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    recorder.Created.push_back(created);
+    recorder.LastRootAfter.push_back(lastRoot);
+    recorder.RootFromTileStartAfter.push_back(rootFromTileStart);
+    recorder.OpStart = nullptr;
+}
+
+/**
+ * Records the painters setting session->LastRootPS back to a paint struct of an earlier op.
+ */
+static void tile_paint_cache_check_last_root(paint_session* session, TilePaintRecorder& recorder)
+{
+    paint_struct* expected = recorder.LastRootAfter.empty() ? nullptr : recorder.LastRootAfter.back();
+    if (session->LastRootPS == expected)
+    {
+        return;
+    }
+
+    int32_t lastRootOp = (int32_t)recorder.LastRootAfter.size() - 1;
+    while (lastRootOp >= 0 && recorder.LastRootAfter[lastRootOp] != session->LastRootPS)
+    {
+        lastRootOp--;
+    }
+    if (lastRootOp < 0 && session->LastRootPS != nullptr)
+    {
+        recorder.Record->Volatile = true;
+        return;
+    }
+
+    TilePaintOp op = {};
+    op.Type = TILE_PAINT_OP_SET_LAST_ROOT;
+    op.LastRootOp = lastRootOp;
+    recorder.Record->Ops.push_back(op);
+    recorder.Created.push_back(nullptr);
+    recorder.LastRootAfter.push_back(session->LastRootPS);
+    recorder.RootFromTileStartAfter.push_back(lastRootOp < 0 || recorder.RootFromTileStartAfter[lastRootOp]);
+}
+
+/**
+ * Called by the paint functions while a tile is being recorded, before they do anything.
+ */
+void tile_paint_cache_record(paint_session* session, TILE_PAINT_OP type, uint32_t imageId, const TilePaintOpArgs& args)
+{
+    auto& recorder = *session->TileRecorder;
+    if (recorder.SkipNextOp)
+    {
+        recorder.SkipNextOp = false;
+        return;
+    }
+
+    tile_paint_cache_finish_op(session, recorder);
+    tile_paint_cache_check_last_root(session, recorder);
+
+    bool rootFromTileStart = recorder.RootFromTileStartAfter.empty() || recorder.RootFromTileStartAfter.back();
+    switch (type)
+    {
+        case TILE_PAINT_OP_98199C:
+            recorder.SkipNextOp = session->LastRootPS == nullptr;
+            break;
+        case TILE_PAINT_OP_ATTACH_TO_PREVIOUS_PS:
+            // Would attach to whatever was painted before the tile
+            if (rootFromTileStart)
+            {
+                recorder.Record->Volatile = true;
+            }
+            break;
+        case TILE_PAINT_OP_ATTACH_TO_PREVIOUS_ATTACH:
+            recorder.SkipNextOp = session->UnkF1AD2C == nullptr;
+            if (rootFromTileStart || recorder.AttachFromTileStart)
+            {
+                recorder.Record->Volatile = true;
+            }
+            break;
+        default:
+            break;
+    }
+
+    TilePaintOp op = {};
+    op.Type = type;
+    op.InteractionType = session->InteractionType;
+    op.ElementIndex = tile_paint_cache_get_element_index(recorder, session->CurrentlyDrawnItem);
+    op.LastRootOp = -1;
+    op.ImageId = imageId;
+    op.SpritePosition = session->SpritePosition;
+    op.MapPosition = session->MapPosition;
+    op.Args = args;
+    recorder.Record->Ops.push_back(op);
+
+    recorder.OpStart = session->NextFreePaintStruct;
+    recorder.OpLastRoot = session->LastRootPS;
+    recorder.OpRootFromTileStart = rootFromTileStart;
+}
+
+void tile_paint_cache_set_volatile(paint_session* session)
+{
+    if (session->TileRecorder != nullptr)
+    {
+        session->TileRecorder->Record->Volatile = true;
+    }
+}
+
+static paint_session* tile_paint_cache_get_scratch_session()
+{
+    // Big enough that the sessions are not created for every tile
+    thread_local std::unique_ptr<paint_session> scratchSession;
+    if (scratchSession == nullptr)
+    {
+        scratchSession = std::make_unique<paint_session>();
+    }
+    return scratchSession.get();
+}
+
+/**
+ * Paints the elements of a tile into a scratch session, which has the same state as the given one but does not clip
+ * anything, and records the paint calls made.
+ */
+static std::shared_ptr<TilePaintRecord> tile_paint_cache_create_record(
+    paint_session* session, TileElement* firstElement, TilePaintElementsFunction paintElements)
+{
+    auto record = std::make_shared<TilePaintRecord>();
+    record->Elements.assign(firstElement, firstElement + tile_paint_cache_count_elements(firstElement));
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const TileElement* neighbour = tile_paint_cache_get_neighbour(session->MapPosition, i);
+        record->HasNeighbour[i] = neighbour != nullptr;
+        if (neighbour != nullptr)
+        {
+            record->Neighbours[i] = *neighbour;
+        }
+    }
+
+    paint_session* scratch = tile_paint_cache_get_scratch_session();
+    scratch->DPI = session->DPI;
+    scratch->DPI.x = -0x4000;
+    scratch->DPI.y = -0x4000;
+    scratch->DPI.width = 0x7FFF;
+    scratch->DPI.height = 0x7FFF;
+    scratch->EndOfPaintStructArray = &scratch->PaintStructs[4000 - 1];
+    scratch->NextFreePaintStruct = scratch->PaintStructs;
+    for (auto& quadrant : scratch->Quadrants)
+    {
+        quadrant = nullptr;
+    }
+    scratch->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
+    scratch->QuadrantFrontIndex = 0;
+    scratch->ViewFlags = session->ViewFlags;
+    scratch->CurrentlyDrawnItem = nullptr;
+    scratch->SpritePosition = session->SpritePosition;
+    scratch->LastRootPS = nullptr;
+    scratch->UnkF1AD2C = nullptr;
+    scratch->InteractionType = session->InteractionType;
+    scratch->CurrentRotation = session->CurrentRotation;
+    std::copy(std::begin(session->SupportSegments), std::end(session->SupportSegments), scratch->SupportSegments);
+    scratch->Support = session->Support;
+    scratch->PSStringHead = nullptr;
+    scratch->LastPSString = nullptr;
+    scratch->WoodenSupportsPrependTo = nullptr;
+    scratch->MapPosition = session->MapPosition;
+    std::copy(std::begin(session->LeftTunnels), std::end(session->LeftTunnels), scratch->LeftTunnels);
+    scratch->LeftTunnelCount = session->LeftTunnelCount;
+    std::copy(std::begin(session->RightTunnels), std::end(session->RightTunnels), scratch->RightTunnels);
+    scratch->RightTunnelCount = session->RightTunnelCount;
+    scratch->VerticalTunnelHeight = session->VerticalTunnelHeight;
+    scratch->SurfaceElement = session->SurfaceElement;
+    scratch->PathElementOnSameHeight = session->PathElementOnSameHeight;
+    scratch->TrackElementOnSameHeight = session->TrackElementOnSameHeight;
+    scratch->DidPassSurface = session->DidPassSurface;
+    scratch->Unk141E9DB = session->Unk141E9DB;
+    scratch->WaterHeight = session->WaterHeight;
+    std::copy(std::begin(session->TrackColours), std::end(session->TrackColours), scratch->TrackColours);
+
+    TilePaintRecorder recorder;
+    recorder.Record = record.get();
+    recorder.FirstElement = firstElement;
+    scratch->TileRecorder = &recorder;
+    record->Result = paintElements(scratch, firstElement);
+    tile_paint_cache_finish_op(scratch, recorder);
+    tile_paint_cache_check_last_root(scratch, recorder);
+    scratch->TileRecorder = nullptr;
+
+    if (scratch->WoodenSupportsPrependTo != nullptr)
+    {
+        record->Volatile = true;
+    }
+
+    record->DrawnItemIndex = tile_paint_cache_get_element_index(recorder, scratch->CurrentlyDrawnItem);
+    record->SurfaceElementIndex = tile_paint_cache_get_element_index(recorder, scratch->SurfaceElement);
+    record->PathElementIndex = tile_paint_cache_get_element_index(recorder, scratch->PathElementOnSameHeight);
+    record->TrackElementIndex = tile_paint_cache_get_element_index(recorder, scratch->TrackElementOnSameHeight);
+    if (record->Volatile)
+    {
+        record->Ops.clear();
+        record->Ops.shrink_to_fit();
+        return record;
+    }
+
+    for (size_t i = 0; i < record->Ops.size(); i++)
+    {
+        auto& op = record->Ops[i];
+        const paint_entry* created = recorder.Created[i];
+        op.Created = created != nullptr;
+        if (created == nullptr)
+        {
+            continue;
+        }
+
+        if (op.Type == TILE_PAINT_OP_ATTACH_TO_PREVIOUS_PS || op.Type == TILE_PAINT_OP_ATTACH_TO_PREVIOUS_ATTACH)
+        {
+            op.FinalImageId = created->attached.image_id;
+            op.FinalColour = created->attached.colour_image_id;
+            op.FinalFlags = created->attached.flags;
+        }
+        else
+        {
+            op.FinalImageId = created->basic.image_id;
+            op.FinalColour = created->basic.tertiary_colour;
+            op.FinalFlags = created->basic.flags;
+        }
+    }
+    record->Ops.shrink_to_fit();
+
+    std::copy(std::begin(scratch->SupportSegments), std::end(scratch->SupportSegments), record->SupportSegments);
+    record->Support = scratch->Support;
+    std::copy(std::begin(scratch->LeftTunnels), std::end(scratch->LeftTunnels), record->LeftTunnels);
+    record->LeftTunnelCount = scratch->LeftTunnelCount;
+    std::copy(std::begin(scratch->RightTunnels), std::end(scratch->RightTunnels), record->RightTunnels);
+    record->RightTunnelCount = scratch->RightTunnelCount;
+    record->VerticalTunnelHeight = scratch->VerticalTunnelHeight;
+    record->DidPassSurface = scratch->DidPassSurface;
+    record->Unk141E9DB = scratch->Unk141E9DB;
+    record->WaterHeight = scratch->WaterHeight;
+    record->InteractionType = scratch->InteractionType;
+    record->SpritePosition = scratch->SpritePosition;
+    record->MapPosition = scratch->MapPosition;
+    return record;
+}
+
+static void tile_paint_cache_apply(paint_struct* ps, const TilePaintOp& op)
+{
+    if (ps != nullptr && op.Created)
+    {
+        ps->image_id = op.FinalImageId;
+        ps->tertiary_colour = op.FinalColour;
+        ps->flags = op.FinalFlags;
+    }
+}
+
+static void tile_paint_cache_apply(attached_paint_struct* ps, const TilePaintOp& op)
+{
+    if (op.Created)
+    {
+        ps->image_id = op.FinalImageId;
+        ps->colour_image_id = op.FinalColour;
+        ps->flags = op.FinalFlags;
+    }
+}
+
+/**
+ * Makes the recorded paint calls on the session, they are clipped against the session's view as usual.
+ */
+static void tile_paint_cache_replay(paint_session* session, const TilePaintRecord& record, TileElement* firstElement)
+{
+    thread_local std::vector<paint_struct*> lastRootAfter;
+    lastRootAfter.clear();
+
+    paint_struct* tileStartRoot = session->LastRootPS;
+    for (const auto& op : record.Ops)
+    {
+        if (op.Type == TILE_PAINT_OP_SET_LAST_ROOT)
+        {
+            session->LastRootPS = op.LastRootOp < 0 ? tileStartRoot : lastRootAfter[op.LastRootOp];
+            lastRootAfter.push_back(session->LastRootPS);
+            continue;
+        }
+
+        session->InteractionType = op.InteractionType;
+        session->CurrentlyDrawnItem = tile_paint_cache_get_element(firstElement, op.ElementIndex);
+        session->SpritePosition = op.SpritePosition;
+        session->MapPosition = op.MapPosition;
+
+        const auto& args = op.Args;
+        switch (op.Type)
+        {
+            case TILE_PAINT_OP_98196C:
+                tile_paint_cache_apply(
+                    sub_98196C(
+                        session, op.ImageId, (int8_t)args.XOffset, (int8_t)args.YOffset, args.BoundBoxLengthX,
+                        args.BoundBoxLengthY, (int8_t)args.BoundBoxLengthZ, args.ZOffset),
+                    op);
+                break;
+            case TILE_PAINT_OP_98197C:
+                tile_paint_cache_apply(
+                    sub_98197C(
+                        session, op.ImageId, (int8_t)args.XOffset, (int8_t)args.YOffset, args.BoundBoxLengthX,
+                        args.BoundBoxLengthY, (int8_t)args.BoundBoxLengthZ, args.ZOffset, args.BoundBoxOffsetX,
+                        args.BoundBoxOffsetY, args.BoundBoxOffsetZ),
+                    op);
+                break;
+            case TILE_PAINT_OP_98198C:
+                tile_paint_cache_apply(
+                    sub_98198C(
+                        session, op.ImageId, (int8_t)args.XOffset, (int8_t)args.YOffset, args.BoundBoxLengthX,
+                        args.BoundBoxLengthY, (int8_t)args.BoundBoxLengthZ, args.ZOffset, args.BoundBoxOffsetX,
+                        args.BoundBoxOffsetY, args.BoundBoxOffsetZ),
+                    op);
+                break;
+            case TILE_PAINT_OP_98199C:
+                tile_paint_cache_apply(
+                    sub_98199C(
+                        session, op.ImageId, (int8_t)args.XOffset, (int8_t)args.YOffset, args.BoundBoxLengthX,
+                        args.BoundBoxLengthY, (int8_t)args.BoundBoxLengthZ, args.ZOffset, args.BoundBoxOffsetX,
+                        args.BoundBoxOffsetY, args.BoundBoxOffsetZ),
+                    op);
+                break;
+            case TILE_PAINT_OP_ATTACH_TO_PREVIOUS_PS:
+                if (paint_attach_to_previous_ps(session, op.ImageId, (uint16_t)args.XOffset, (uint16_t)args.YOffset))
+                {
+                    tile_paint_cache_apply(session->UnkF1AD2C, op);
+                }
+                break;
+            case TILE_PAINT_OP_ATTACH_TO_PREVIOUS_ATTACH:
+                if (paint_attach_to_previous_attach(session, op.ImageId, (uint16_t)args.XOffset, (uint16_t)args.YOffset))
+                {
+                    tile_paint_cache_apply(session->UnkF1AD2C, op);
+                }
+                break;
+            default:
+                break;
+        }
+        lastRootAfter.push_back(session->LastRootPS);
+    }
+
+    std::copy(std::begin(record.SupportSegments), std::end(record.SupportSegments), session->SupportSegments);
+    session->Support = record.Support;
+    std::copy(std::begin(record.LeftTunnels), std::end(record.LeftTunnels), session->LeftTunnels);
+    session->LeftTunnelCount = record.LeftTunnelCount;
+    std::copy(std::begin(record.RightTunnels), std::end(record.RightTunnels), session->RightTunnels);
+    session->RightTunnelCount = record.RightTunnelCount;
+    session->VerticalTunnelHeight = record.VerticalTunnelHeight;
+    session->DidPassSurface = record.DidPassSurface;
+    session->Unk141E9DB = record.Unk141E9DB;
+    session->WaterHeight = record.WaterHeight;
+    session->InteractionType = record.InteractionType;
+    session->SpritePosition = record.SpritePosition;
+    session->MapPosition = record.MapPosition;
+    session->CurrentlyDrawnItem = tile_paint_cache_get_element(firstElement, record.DrawnItemIndex);
+    session->SurfaceElement = tile_paint_cache_get_element(firstElement, record.SurfaceElementIndex);
+    session->PathElementOnSameHeight = tile_paint_cache_get_element(firstElement, record.PathElementIndex);
+    session->TrackElementOnSameHeight = tile_paint_cache_get_element(firstElement, record.TrackElementIndex);
+}
+
+static std::shared_ptr<const TilePaintRecord> tile_paint_cache_find(
+    uint64_t key, const TileElement* firstElement, const CoordsXY& mapPosition)
+{
+    auto& shard = tile_paint_cache_get_shard(key);
+    std::shared_ptr<const TilePaintRecord> record;
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        auto it = shard.Map.find(key);
+        if (it == shard.Map.end())
+        {
+            return nullptr;
+        }
+        shard.Entries.splice(shard.Entries.begin(), shard.Entries, it->second);
+        record = it->second->Record;
+    }
+
+    // Records are not changed once they are added, so the tile is compared without holding the lock. An outdated
+    // record is replaced when the tile is recorded again.
+    if (!tile_paint_cache_is_valid(*record, firstElement, mapPosition))
+    {
+        return nullptr;
+    }
+    return record;
+}
+
+static void tile_paint_cache_add(uint64_t key, std::shared_ptr<const TilePaintRecord> record)
+{
+    size_t size = sizeof(TilePaintCacheEntry) + sizeof(TilePaintRecord) + record->Elements.size() * sizeof(TileElement)
+        + record->Ops.size() * sizeof(TilePaintOp);
+
+    auto& shard = tile_paint_cache_get_shard(key);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Map.find(key);
+    if (it != shard.Map.end())
+    {
+        // Outdated, or recorded by another column at the same time
+        shard.Size -= it->second->Size;
+        shard.Entries.erase(it->second);
+        shard.Map.erase(it);
+    }
+
+    shard.Entries.push_front({ key, size, std::move(record) });
+    shard.Map[key] = shard.Entries.begin();
+    shard.Size += size;
+    while (shard.Size > TILE_PAINT_CACHE_MAX_SIZE / TILE_PAINT_CACHE_SHARD_COUNT)
+    {
+        auto last = std::prev(shard.Entries.end());
+        shard.Size -= last->Size;
+        shard.Map.erase(last->Key);
+        shard.Entries.erase(last);
+    }
+}
+
+/**
+ * Paints the elements of the tile at session->MapPosition, replaying them from the cache when they have been painted
+ * before.
+ */
+bool tile_paint_cache_paint(paint_session* session, TileElement* firstElement, TilePaintElementsFunction paintElements)
+{
+    // Supports that are prepended to track pieces link paint structs in ways that are not recorded
+    if (!_tilePaintCacheEnabled || session->TileRecorder != nullptr || session->WoodenSupportsPrependTo != nullptr
+        || session->Unk141E9DB != 0)
+    {
+        return paintElements(session, firstElement);
+    }
+
+    uint64_t key = tile_paint_cache_get_key(session);
+    auto record = tile_paint_cache_find(key, firstElement, session->MapPosition);
+    if (record == nullptr)
+    {
+        auto newRecord = tile_paint_cache_create_record(session, firstElement, paintElements);
+        tile_paint_cache_add(key, newRecord);
+        record = std::move(newRecord);
+    }
+
+    if (record->Volatile)
+    {
+        return paintElements(session, firstElement);
+    }
+    tile_paint_cache_replay(session, *record, firstElement);
+    return record->Result;
+}
@@ -0,0 +1,60 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+struct paint_session;
+struct TileElement;
+
+/**
+ * The paint calls made for the elements of a tile are recorded the first time the tile is painted and replayed in
+ * later frames for as long as the tile's elements, the surfaces next to it and the view stay the same. Replaying
+ * still goes through the paint functions, so the paint structs are clipped and sorted together with the sprites of
+ * the frame just like before.
+ */
+enum TILE_PAINT_OP : uint8_t
+{
+    TILE_PAINT_OP_98196C,
+    TILE_PAINT_OP_98197C,
+    TILE_PAINT_OP_98198C,
+    TILE_PAINT_OP_98199C,
+    TILE_PAINT_OP_ATTACH_TO_PREVIOUS_PS,
+    TILE_PAINT_OP_ATTACH_TO_PREVIOUS_ATTACH,
+    // Not a paint call, the painters restored session->LastRootPS to what it was after an earlier call.
+    TILE_PAINT_OP_SET_LAST_ROOT,
+};
+
+struct TilePaintOpArgs
+{
+    int16_t XOffset;
+    int16_t YOffset;
+    int16_t BoundBoxLengthX;
+    int16_t BoundBoxLengthY;
+    int16_t BoundBoxLengthZ;
+    int16_t ZOffset;
+    int16_t BoundBoxOffsetX;
+    int16_t BoundBoxOffsetY;
+    int16_t BoundBoxOffsetZ;
+};
+
+/** Paints the elements of a tile, returns false if the tile ended on an element that hides everything after it. */
+using TilePaintElementsFunction = bool (*)(paint_session* session, TileElement* firstElement);
+
+void tile_paint_cache_update();
+bool tile_paint_cache_paint(paint_session* session, TileElement* firstElement, TilePaintElementsFunction paintElements);
+void tile_paint_cache_record(paint_session* session, TILE_PAINT_OP type, uint32_t imageId, const TilePaintOpArgs& args);
+void tile_paint_cache_clear();
+
+/**
+ * Called by painters that draw something that changes without the tile's elements changing, e.g. animations or
+ * text, so that the tile is always painted from its elements.
+ */
+void tile_paint_cache_set_volatile(paint_session* session);
@@ -20,6 +20,7 @@
 #include "../../world/Scenery.h"
 #include "../Paint.h"
 #include "../Supports.h"
+#include "../TilePaintCache.h"
 #include "Paint.TileElement.h"
 
 #include <iterator>
@@ -284,6 +285,8 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
     }
     if (entry->large_scenery.flags & LARGE_SCENERY_FLAG_3D_TEXT)
     {
+        // The text comes from the banner
+        tile_paint_cache_set_volatile(session);
         if (entry->large_scenery.tiles[1].x_offset != (int16_t)(uint16_t)0xFFFF)
         {
             int32_t sequenceDirection = (tileElement->AsLargeScenery()->GetSequenceIndex() - 1) & 3;
@@ -24,6 +24,7 @@
 #include "../../world/Surface.h"
 #include "../Paint.h"
 #include "../Supports.h"
+#include "../TilePaintCache.h"
 #include "Paint.Surface.h"
 #include "Paint.TileElement.h"
 
@@ -441,6 +442,7 @@ static void sub_6A4101(
 
         direction--;
         // If text shown
+        tile_paint_cache_set_volatile(session);
         auto ride = get_ride(tile_element->AsPath()->GetRideIndex());
         if (direction < 2 && ride != nullptr && imageFlags == 0)
         {
@@ -961,6 +963,8 @@ void path_paint(paint_session* session, uint16_t height, const TileElement* tile
             rct_scenery_entry* sceneryEntry = tile_element->AsPath()->GetAdditionEntry();
             if (sceneryEntry != nullptr && sceneryEntry->path_bit.flags & PATH_BIT_FLAG_LAMP)
             {
+                // The lights are only added while painting
+                tile_paint_cache_set_volatile(session);
                 if (!(tile_element->AsPath()->GetEdges() & EDGE_NE))
                 {
                     lightfx_add_3d_light_magic_from_drawing_tile(
@@ -17,6 +17,7 @@
 #include "../../world/SmallScenery.h"
 #include "../Paint.h"
 #include "../Supports.h"
+#include "../TilePaintCache.h"
 #include "Paint.TileElement.h"
 
 static constexpr const LocationXY16 lengths[] = {
@@ -176,6 +177,7 @@ void scenery_paint(paint_session* session, uint8_t direction, int32_t height, co
 
     if (scenery_small_entry_has_flag(entry, SMALL_SCENERY_FLAG_ANIMATED))
     {
+        tile_paint_cache_set_volatile(session);
         rct_drawpixelinfo* dpi = &session->DPI;
         if ((scenery_small_entry_has_flag(entry, SMALL_SCENERY_FLAG_VISIBLE_WHEN_ZOOMED)) || (dpi->zoom_level <= 1))
         {
@@ -27,6 +27,7 @@
 #include "../../world/Surface.h"
 #include "../Paint.h"
 #include "../Supports.h"
+#include "../TilePaintCache.h"
 #include "../VirtualFloor.h"
 #include "Paint.Surface.h"
 
@@ -130,6 +131,111 @@ static void blank_tiles_paint(paint_session* session, int32_t x, int32_t y)
 
 bool gShowSupportSegmentHeights = false;
 
+/**
+ * Paints the elements of the tile at session->MapPosition, returns false if an element hides all the elements after it.
+ */
+bool tile_element_paint_elements(paint_session* session, TileElement* tile_element)
+{
+    uint8_t rotation = session->CurrentRotation;
+    int32_t previousHeight = 0;
+    do
+    {
+        // Only paint tile_elements below the clip height.
+        if ((session->ViewFlags & VIEWPORT_FLAG_CLIP_VIEW) && (tile_element->base_height > gClipHeight))
+            continue;
+
+        Direction direction = tile_element->GetDirectionWithOffset(rotation);
+        int32_t height = tile_element->base_height * 8;
+
+        // If we are on a new height level, look through elements on the
+        //  same height and store any types might be relevant to others
+        if (height != previousHeight)
+        {
+            previousHeight = height;
+            session->PathElementOnSameHeight = nullptr;
+            session->TrackElementOnSameHeight = nullptr;
+            TileElement* tile_element_sub_iterator = tile_element;
+            while (!(tile_element_sub_iterator++)->IsLastForTile())
+            {
+                if (tile_element_sub_iterator->base_height != tile_element->base_height)
+                {
+                    break;
+                }
+                switch (tile_element_sub_iterator->GetType())
+                {
+                    case TILE_ELEMENT_TYPE_PATH:
+                        session->PathElementOnSameHeight = tile_element_sub_iterator;
+                        break;
+                    case TILE_ELEMENT_TYPE_TRACK:
+                        session->TrackElementOnSameHeight = tile_element_sub_iterator;
+                        break;
+                    case TILE_ELEMENT_TYPE_CORRUPT:
+                        // To preserve regular behaviour, make an element hidden by
+                        //  corruption also invisible to this method.
+                        if (tile_element->IsLastForTile())
+                        {
+                            break;
+                        }
+                        tile_element_sub_iterator++;
+                        break;
+                }
+            }
+        }
+
+#ifndef __TESTPAINT__
+        // Track pieces and entrances are painted from their ride and banners scroll their text, none of it is in the elements
+        auto type = tile_element->GetType();
+        if (type == TILE_ELEMENT_TYPE_TRACK || type == TILE_ELEMENT_TYPE_ENTRANCE || type == TILE_ELEMENT_TYPE_BANNER)
+        {
+            tile_paint_cache_set_volatile(session);
+        }
+#endif // __TESTPAINT__
+
+        CoordsXY mapPosition = session->MapPosition;
+        session->CurrentlyDrawnItem = tile_element;
+        // Setup the painting of for example: the underground, signs, rides, scenery, etc.
+        switch (tile_element->GetType())
+        {
+            case TILE_ELEMENT_TYPE_SURFACE:
+                surface_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_PATH:
+                path_paint(session, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_TRACK:
+                track_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                scenery_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+                entrance_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_WALL:
+                fence_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+                large_scenery_paint(session, direction, height, tile_element);
+                break;
+            case TILE_ELEMENT_TYPE_BANNER:
+                banner_paint(session, direction, height, tile_element);
+                break;
+            // A corrupt element inserted by OpenRCT2 itself, which skips the drawing of the next element only.
+            case TILE_ELEMENT_TYPE_CORRUPT:
+                if (tile_element->IsLastForTile())
+                    return false;
+                tile_element++;
+                break;
+            default:
+                // An undefined map element is most likely a corrupt element inserted by 8 cars' MOM feature to skip drawing of
+                // all elements after it.
+                return false;
+        }
+        session->MapPosition = mapPosition;
+    } while (!(tile_element++)->IsLastForTile());
+    return true;
+}
+
 /**
  *
  *  rct2: 0x0068B3FB
@@ -243,93 +349,17 @@ static void sub_68B3FB(paint_session* session, int32_t x, int32_t y)
     session->SpritePosition.x = x;
     session->SpritePosition.y = y;
     session->DidPassSurface = false;
-    int32_t previousHeight = 0;
-    do
+#ifndef __TESTPAINT__
+    if (!tile_paint_cache_paint(session, tile_element, tile_element_paint_elements))
     {
-        // Only paint tile_elements below the clip height.
-        if ((session->ViewFlags & VIEWPORT_FLAG_CLIP_VIEW) && (tile_element->base_height > gClipHeight))
-            continue;
-
-        Direction direction = tile_element->GetDirectionWithOffset(rotation);
-        int32_t height = tile_element->base_height * 8;
-
-        // If we are on a new height level, look through elements on the
-        //  same height and store any types might be relevant to others
-        if (height != previousHeight)
-        {
-            previousHeight = height;
-            session->PathElementOnSameHeight = nullptr;
-            session->TrackElementOnSameHeight = nullptr;
-            TileElement* tile_element_sub_iterator = tile_element;
-            while (!(tile_element_sub_iterator++)->IsLastForTile())
-            {
-                if (tile_element_sub_iterator->base_height != tile_element->base_height)
-                {
-                    break;
-                }
-                switch (tile_element_sub_iterator->GetType())
-                {
-                    case TILE_ELEMENT_TYPE_PATH:
-                        session->PathElementOnSameHeight = tile_element_sub_iterator;
-                        break;
-                    case TILE_ELEMENT_TYPE_TRACK:
-                        session->TrackElementOnSameHeight = tile_element_sub_iterator;
-                        break;
-                    case TILE_ELEMENT_TYPE_CORRUPT:
-                        // To preserve regular behaviour, make an element hidden by
-                        //  corruption also invisible to this method.
-                        if (tile_element->IsLastForTile())
-                        {
-                            break;
-                        }
-                        tile_element_sub_iterator++;
-                        break;
-                }
-            }
-        }
-
-        CoordsXY mapPosition = session->MapPosition;
-        session->CurrentlyDrawnItem = tile_element;
-        // Setup the painting of for example: the underground, signs, rides, scenery, etc.
-        switch (tile_element->GetType())
-        {
-            case TILE_ELEMENT_TYPE_SURFACE:
-                surface_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_PATH:
-                path_paint(session, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_TRACK:
-                track_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
-                scenery_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_ENTRANCE:
-                entrance_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_WALL:
-                fence_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                large_scenery_paint(session, direction, height, tile_element);
-                break;
-            case TILE_ELEMENT_TYPE_BANNER:
-                banner_paint(session, direction, height, tile_element);
-                break;
-            // A corrupt element inserted by OpenRCT2 itself, which skips the drawing of the next element only.
-            case TILE_ELEMENT_TYPE_CORRUPT:
-                if (tile_element->IsLastForTile())
-                    return;
-                tile_element++;
-                break;
-            default:
-                // An undefined map element is most likely a corrupt element inserted by 8 cars' MOM feature to skip drawing of
-                // all elements after it.
-                return;
-        }
-        session->MapPosition = mapPosition;
-    } while (!(tile_element++)->IsLastForTile());
+        return;
+    }
+#else
+    if (!tile_element_paint_elements(session, tile_element))
+    {
+        return;
+    }
+#endif // __TESTPAINT__
 
 #ifndef __TESTPAINT__
     if (gConfigGeneral.virtual_floor_style != VIRTUAL_FLOOR_STYLE_OFF && partOfVirtualFloor)
@@ -99,6 +99,7 @@ void paint_util_set_segment_support_height(paint_session* session, int32_t segme
 uint16_t paint_util_rotate_segments(uint16_t segments, uint8_t rotation);
 
 void tile_element_paint_setup(paint_session* session, int32_t x, int32_t y);
+bool tile_element_paint_elements(paint_session* session, TileElement* tile_element);
 
 void entrance_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tile_element);
 void banner_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tile_element);
@@ -21,6 +21,7 @@
 #include "../../world/Scenery.h"
 #include "../../world/Wall.h"
 #include "../Paint.h"
+#include "../TilePaintCache.h"
 #include "Paint.TileElement.h"
 
 static constexpr const uint8_t byte_9A406C[] = {
@@ -167,6 +168,7 @@ void fence_paint(paint_session* session, uint8_t direction, int32_t height, cons
 
     if (sceneryEntry->wall.flags2 & WALL_SCENERY_2_ANIMATED)
     {
+        tile_paint_cache_set_volatile(session);
         frameNum = (gCurrentTicks & 7) * 2;
     }
 
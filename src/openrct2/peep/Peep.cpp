@@ -3360,6 +3360,7 @@ void peep_update_name_sort(Peep* peep)
 finish_peep_sort:
     // This is required at the moment because this function reorders peeps in the sprite list
     sprite_position_tween_reset();
+    staff_index_invalidate();
 }
 
 void peep_sort()
@@ -3396,6 +3397,7 @@ void peep_sort()
     gSpriteListHead[SPRITE_LIST_PEEP] = peep_list[0];
 
     free(peep_list);
+    staff_index_invalidate();
 
     i = 0;
     FOR_ALL_PEEPS (sprite_index, peep)
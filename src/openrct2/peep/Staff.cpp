@@ -41,6 +41,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -140,23 +141,85 @@ void staff_update_greyed_patrol_areas()
             gStaffPatrolAreas[staffPatrolOffset + i] = 0;
         }
 
-        for (uint16_t sprite_index = gSpriteListHead[SPRITE_LIST_PEEP]; sprite_index != SPRITE_INDEX_NULL;
-             sprite_index = peep->next)
+        for (auto spriteIndex : staff_index_get(staff_type))
         {
-            peep = GET_PEEP(sprite_index);
+            peep = GET_PEEP(spriteIndex);
 
-            if (peep->type == PEEP_TYPE_STAFF && staff_type == peep->staff_type)
+            int32_t peepPatrolOffset = peep->staff_id * STAFF_PATROL_AREA_SIZE;
+            for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
             {
-                int32_t peepPatrolOffset = peep->staff_id * STAFF_PATROL_AREA_SIZE;
-                for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-                {
-                    gStaffPatrolAreas[staffPatrolOffset + i] |= gStaffPatrolAreas[peepPatrolOffset + i];
-                }
+                gStaffPatrolAreas[staffPatrolOffset + i] |= gStaffPatrolAreas[peepPatrolOffset + i];
             }
         }
     }
 }
 
+/**
+ * The staff of each type, in the same order as they appear in the peep sprite list, so that staff of one type can
+ * be found without going through every guest. Staff that have since been fired or removed are dropped when the list
+ * of their type is next asked for. Anything else that changes the peep sprite list, adding peeps, sorting them by name
+ * or loading a park, has to invalidate the index, as ties between staff are resolved by that order.
+ */
+static std::vector<uint16_t> _staffIndex[STAFF_TYPE_COUNT];
+static bool _staffIndexValid = false;
+
+static void staff_index_rebuild()
+{
+    for (auto& staff : _staffIndex)
+    {
+        staff.clear();
+    }
+
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_STAFF (spriteIndex, peep)
+    {
+        if (peep->staff_type < STAFF_TYPE_COUNT)
+        {
+            _staffIndex[peep->staff_type].push_back(spriteIndex);
+        }
+    }
+    _staffIndexValid = true;
+}
+
+/**
+ * Marks the staff index as out of date, it will be rebuilt from the peep sprite list the next time it is used.
+ * Needs to be called whenever peeps are added to or reordered in the peep sprite list, or the sprites are replaced as a
+ * whole, e.g. when a park is loaded.
+ */
+void staff_index_invalidate()
+{
+    _staffIndexValid = false;
+}
+
+/**
+ * Returns the sprite indices of all staff of the given type, in FOR_ALL_STAFF order.
+ */
+const std::vector<uint16_t>& staff_index_get(uint8_t staffType)
+{
+    static const std::vector<uint16_t> NoStaff;
+    if (staffType >= STAFF_TYPE_COUNT)
+    {
+        return NoStaff;
+    }
+    if (!_staffIndexValid)
+    {
+        staff_index_rebuild();
+    }
+
+    auto& staff = _staffIndex[staffType];
+    staff.erase(
+        std::remove_if(
+            staff.begin(), staff.end(),
+            [staffType](uint16_t spriteIndex) {
+                auto sprite = get_sprite(spriteIndex);
+                return sprite->generic.linked_list_index != SPRITE_LIST_PEEP || sprite->peep.type != PEEP_TYPE_STAFF
+                    || sprite->peep.staff_type != staffType;
+            }),
+        staff.end());
+    return staff;
+}
+
 static bool staff_is_location_in_patrol_area(Peep* peep, int32_t x, int32_t y)
 {
     // Patrol quads are stored in a bit map (8 patrol quads per byte)
@@ -415,32 +478,92 @@ void staff_toggle_patrol_area(int32_t staffIndex, int32_t x, int32_t y)
     gStaffPatrolAreas[peepOffset + offset] ^= (1 << bitIndex);
 }
 
+static uint16_t staff_handyman_get_litter_distance(const Peep* peep, const rct_litter* litter)
+{
+    return abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
+}
+
 /**
- *
- *  rct2: 0x006BFBE8
- *
- * Returns 0xFF when no nearby litter or unpathable litter
+ * Finds the litter closest to the handyman, as long as it is no further away than maxDistance. Only the tiles
+ * around the handyman are searched, unless litter on different tiles is equally close. Then the whole litter list
+ * has to be searched because the first of them in the list is used.
  */
-static uint8_t staff_handyman_direction_to_nearest_litter(Peep* peep)
+static rct_litter* staff_handyman_get_nearest_litter(const Peep* peep, uint16_t maxDistance)
 {
     uint16_t nearestLitterDist = (uint16_t)-1;
     rct_litter* nearestLitter = nullptr;
-    rct_litter* litter = nullptr;
+    bool isAmbiguous = false;
 
-    for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != 0xFFFF; litterIndex = litter->next)
+    int32_t minTileX = std::max(0, (peep->x - maxDistance) / 32);
+    int32_t minTileY = std::max(0, (peep->y - maxDistance) / 32);
+    int32_t maxTileX = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, (peep->x + maxDistance) / 32);
+    int32_t maxTileY = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, (peep->y + maxDistance) / 32);
+    for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
     {
-        litter = &get_sprite(litterIndex)->litter;
+        for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+        {
+            uint16_t spriteIndex = sprite_get_first_in_quadrant(tileX * 32, tileY * 32);
+            while (spriteIndex != SPRITE_INDEX_NULL)
+            {
+                rct_sprite* sprite = get_sprite(spriteIndex);
+                spriteIndex = sprite->generic.next_in_quadrant;
+                if (sprite->generic.linked_list_index != SPRITE_LIST_LITTER)
+                    continue;
+
+                rct_litter* litter = &sprite->litter;
+                uint16_t distance = staff_handyman_get_litter_distance(peep, litter);
+                if (distance > maxDistance)
+                    continue;
 
-        uint16_t distance = abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
+                if (distance < nearestLitterDist)
+                {
+                    nearestLitterDist = distance;
+                    nearestLitter = litter;
+                    isAmbiguous = false;
+                }
+                else if (distance == nearestLitterDist)
+                {
+                    // Only the tile of the litter matters, equally close litter on the same tile gives the same result
+                    if ((litter->x & 0xFFE0) != (nearestLitter->x & 0xFFE0)
+                        || (litter->y & 0xFFE0) != (nearestLitter->y & 0xFFE0))
+                    {
+                        isAmbiguous = true;
+                    }
+                }
+            }
+        }
+    }
 
-        if (distance < nearestLitterDist)
+    if (isAmbiguous)
+    {
+        nearestLitterDist = (uint16_t)-1;
+        rct_litter* litter = nullptr;
+        for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != SPRITE_INDEX_NULL;
+             litterIndex = litter->next)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            litter = &get_sprite(litterIndex)->litter;
+
+            uint16_t distance = staff_handyman_get_litter_distance(peep, litter);
+            if (distance < nearestLitterDist)
+            {
+                nearestLitterDist = distance;
+                nearestLitter = litter;
+            }
         }
     }
+    return nearestLitter;
+}
 
-    if (nearestLitterDist > 0x60)
+/**
+ *
+ *  rct2: 0x006BFBE8
+ *
+ * Returns 0xFF when no nearby litter or unpathable litter
+ */
+static uint8_t staff_handyman_direction_to_nearest_litter(Peep* peep)
+{
+    rct_litter* nearestLitter = staff_handyman_get_nearest_litter(peep, 0x60);
+    if (nearestLitter == nullptr)
     {
         return 0xFF;
     }
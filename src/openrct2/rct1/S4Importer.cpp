@@ -23,6 +23,7 @@
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -1358,6 +1359,7 @@ private:
                 ImportPeep(peep, srcPeep);
             }
         }
+        staff_index_invalidate();
         for (size_t i = 0; i < MAX_SPRITES; i++)
         {
             rct_sprite* sprite = get_sprite(i);
@@ -2726,6 +2728,11 @@ private:
         }
 
         gNextFreeTileElement = nextFreeTileElement;
+        viewport_hit_test_clear();
+        ride_tile_index_invalidate();
+        track_block_links_invalidate();
+        park_size_invalidate();
+        map_active_tiles_invalidate();
     }
 
     void FixWalls()
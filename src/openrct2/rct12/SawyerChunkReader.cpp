@@ -142,6 +142,16 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
     }
 }
 
+void SawyerChunkReader::ValidateUnencodedChunkHeader(const sawyercoding_chunk_header& header, uint64_t remainingLength)
+{
+    if (header.encoding != CHUNK_ENCODING_NONE)
+        throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE || header.length > remainingLength)
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    if (header.length == 0)
+        throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+}
+
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
     auto chunk = ReadChunk();
@@ -45,6 +45,14 @@ public:
      */
     std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
+    /**
+     * Throws the same exceptions as ReadChunk would for a chunk stored without encoding,
+     * for readers that access the chunk data in place rather than through ReadChunk.
+     * @param header The header of the chunk.
+     * @param remainingLength The number of bytes available after the header.
+     */
+    static void ValidateUnencodedChunkHeader(const sawyercoding_chunk_header& header, uint64_t remainingLength);
+
     /**
      * Reads the next chunk from the stream and copies it directly to the
      * destination buffer. If the chunk is larger than length, only length
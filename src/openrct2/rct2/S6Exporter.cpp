@@ -1336,27 +1336,56 @@ void S6Exporter::ExportMapAnimations()
 
 void S6Exporter::ExportTileElements()
 {
-    for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    // The elements may not be stored row by row in memory (see map_reorganise_elements), but the saved game has to have
+    // them row by row. Any space left over is exported as blank elements, just as map_reorganise_elements leaves it.
+    uint32_t index = 0;
+    bool overflow = false;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL && !overflow; y++)
     {
-        auto src = &gTileElements[index];
-        auto dst = &_s6.tile_elements[index];
-        if (src->base_height == 0xFF)
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL && !overflow; x++)
         {
-            std::memcpy(dst, src, sizeof(*dst));
-        }
-        else
-        {
-            auto tileElementType = (RCT12TileElementType)src->GetType();
-            if (tileElementType == RCT12TileElementType::Corrupt || tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                std::memcpy(dst, src, sizeof(*dst));
-            else
-                ExportTileElement(dst, src);
+            TileElement* src = map_get_first_element_at(x, y);
+            if (src == nullptr)
+                continue;
+            do
+            {
+                if (index >= RCT2_MAX_TILE_ELEMENTS)
+                {
+                    log_error("Too many tile elements to export, stopped at tile %d, %d.", x, y);
+                    overflow = true;
+                    break;
+                }
+                ExportTileElementOrCopy(&_s6.tile_elements[index++], src);
+            } while (!(src++)->IsLastForTile());
         }
     }
+
+    TileElement blankElement;
+    std::memset(&blankElement, 0, sizeof(blankElement));
+    for (; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    {
+        ExportTileElementOrCopy(&_s6.tile_elements[index], &blankElement);
+    }
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
 }
 
+void S6Exporter::ExportTileElementOrCopy(RCT12TileElement* dst, TileElement* src)
+{
+    if (src->base_height == 0xFF)
+    {
+        std::memcpy(dst, src, sizeof(*dst));
+    }
+    else
+    {
+        auto tileElementType = (RCT12TileElementType)src->GetType();
+        if (tileElementType == RCT12TileElementType::Corrupt || tileElementType == RCT12TileElementType::EightCarsCorrupt14
+            || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
+            std::memcpy(dst, src, sizeof(*dst));
+        else
+            ExportTileElement(dst, src);
+    }
+}
+
 void S6Exporter::ExportTileElement(RCT12TileElement* dst, TileElement* src)
 {
     // Todo: allow for changing defition of OpenRCT2 tile element types - replace with a map
@@ -71,6 +71,7 @@ private:
 
     void ExportTileElements();
     void ExportTileElement(RCT12TileElement* dst, TileElement* src);
+    void ExportTileElementOrCopy(RCT12TileElement* dst, TileElement* src);
 
     opt::optional<uint16_t> AllocateUserString(const std::string_view& value);
     void ExportUserStrings();
@@ -453,6 +453,7 @@ public:
         check_for_sprite_list_cycles(true);
         check_for_spatial_index_cycles(true);
         int32_t disjoint_sprites_count = fix_disjoint_sprites();
+        staff_index_invalidate();
         // This one is less harmful, no need to assert for it ~janisozaur
         if (disjoint_sprites_count > 0)
         {
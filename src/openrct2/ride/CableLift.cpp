@@ -254,7 +254,7 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
             input.y = vehicle->track_y;
             input.element = trackElement;
 
-            if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
+            if (!track_block_get_next_cached(&input, &output, &outputZ, &outputDirection))
                 return false;
 
             if (TrackDefinitions[output.element->AsTrack()->GetTrackType()].vangle_start != _vehicleVAngleEndF64E36
@@ -330,7 +330,7 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
             input.element = trackElement;
             track_begin_end output;
 
-            if (!track_block_get_previous(input.x, input.y, input.element, &output))
+            if (!track_block_get_previous_cached(input.x, input.y, input.element, &output))
                 return false;
 
             if (TrackDefinitions[output.begin_element->AsTrack()->GetTrackType()].vangle_end != _vehicleVAngleEndF64E36
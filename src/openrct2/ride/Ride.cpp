@@ -69,6 +69,8 @@
 #include <cstdlib>
 #include <iterator>
 #include <limits>
+#include <set>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 
@@ -134,6 +136,7 @@ static void ride_inspection_update(Ride* ride);
 static void ride_mechanic_status_update(Ride* ride, int32_t mechanicStatus);
 static void ride_music_update(Ride* ride);
 static void ride_shop_connected(Ride* ride);
+static const std::set<uint32_t>& ride_tile_index_get(ride_id_t rideIndex);
 void loc_6DDF9C(Ride* ride, TileElement* tileElement);
 
 RideManager GetRideManager()
@@ -445,41 +448,47 @@ bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output)
 {
     TileElement* resultTileElement = nullptr;
 
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
+    for (auto tileIndex : ride_tile_index_get(ride->id))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-        if (it.element->AsTrack()->GetRideIndex() != ride->id)
+        int32_t x = tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL;
+        int32_t y = tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL;
+        TileElement* tileElement = map_get_first_element_at(x, y);
+        if (tileElement == nullptr)
             continue;
+        do
+        {
+            if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                continue;
+            if (tileElement->AsTrack()->GetRideIndex() != ride->id)
+                continue;
 
-        // Found a track piece for target ride
+            // Found a track piece for target ride
 
-        // Check if it's not the station or ??? (but allow end piece of station)
-        bool specialTrackPiece
-            = (it.element->AsTrack()->GetTrackType() != TRACK_ELEM_BEGIN_STATION
-               && it.element->AsTrack()->GetTrackType() != TRACK_ELEM_MIDDLE_STATION
-               && (TrackSequenceProperties[it.element->AsTrack()->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN));
+            // Check if it's not the station or ??? (but allow end piece of station)
+            bool specialTrackPiece
+                = (tileElement->AsTrack()->GetTrackType() != TRACK_ELEM_BEGIN_STATION
+                   && tileElement->AsTrack()->GetTrackType() != TRACK_ELEM_MIDDLE_STATION
+                   && (TrackSequenceProperties[tileElement->AsTrack()->GetTrackType()][0] & TRACK_SEQUENCE_FLAG_ORIGIN));
 
-        // Set result tile to this track piece if first found track or a ???
-        if (resultTileElement == nullptr || specialTrackPiece)
-        {
-            resultTileElement = it.element;
-
-            if (output != nullptr)
+            // Set result tile to this track piece if first found track or a ???
+            if (resultTileElement == nullptr || specialTrackPiece)
             {
-                output->element = resultTileElement;
-                output->x = it.x * 32;
-                output->y = it.y * 32;
+                resultTileElement = tileElement;
+
+                if (output != nullptr)
+                {
+                    output->element = resultTileElement;
+                    output->x = x * 32;
+                    output->y = y * 32;
+                }
             }
-        }
 
-        if (specialTrackPiece)
-        {
-            return true;
-        }
-    } while (tile_element_iterator_next(&it));
+            if (specialTrackPiece)
+            {
+                return true;
+            }
+        } while (!(tileElement++)->IsLastForTile());
+    }
 
     return resultTileElement != nullptr;
 }
@@ -749,6 +758,159 @@ bool track_block_get_previous(int32_t x, int32_t y, TileElement* tileElement, tr
     return track_block_get_previous_from_zero(coords.x, coords.y, z, ride, rotation, outTrackBeginEnd);
 }
 
+/**
+ * The track pieces before and after each piece that vehicles have crossed, so that a vehicle moving onto the next
+ * piece does not have to search the map for it every time. Links are looked up by element, which only identifies
+ * the same piece for as long as no tile elements are inserted, removed or replaced, so any of those drops all of
+ * them. Only links that lead somewhere are kept, ends of the track are searched for every time.
+ */
+struct TrackBlockLinks
+{
+    // What the piece looked like when the links were found, in-place changes to it drop the links
+    uint64_t Key = 0;
+    int32_t X = LOCATION_NULL;
+    int32_t Y = LOCATION_NULL;
+
+    bool HasNext = false;
+    CoordsXYE Next = {};
+    uint64_t NextKey = 0;
+    int32_t NextZ = 0;
+    int32_t NextDirection = 0;
+
+    bool HasPrevious = false;
+    track_begin_end Previous = {};
+    uint64_t PreviousKey = 0;
+};
+
+static std::unordered_map<const TileElement*, TrackBlockLinks> _trackBlockLinks[MAX_RIDES];
+static uint32_t _trackBlockLinksGeneration[MAX_RIDES];
+static uint32_t _trackBlockLinksCurrentGeneration = 1;
+
+/**
+ * Everything track_block_get_next and track_block_get_previous depend on about a track element.
+ */
+static uint64_t track_block_links_get_key(const Ride* ride, const TileElement* tileElement)
+{
+    auto trackElement = tileElement->AsTrack();
+    if (trackElement == nullptr)
+        return 0;
+
+    return ((uint64_t)ride->type << 48) | ((uint64_t)trackElement->GetRideIndex() << 40)
+        | ((uint64_t)trackElement->GetTrackType() << 24) | ((uint64_t)trackElement->GetSequenceIndex() << 16)
+        | ((uint64_t)tileElement->base_height << 8) | (tileElement->GetDirection() << 1) | (tileElement->IsGhost() ? 1 : 0);
+}
+
+static TrackBlockLinks& track_block_links_get(const Ride* ride, int32_t x, int32_t y, const TileElement* tileElement)
+{
+    auto& links = _trackBlockLinks[ride->id];
+    if (_trackBlockLinksGeneration[ride->id] != _trackBlockLinksCurrentGeneration)
+    {
+        links.clear();
+        _trackBlockLinksGeneration[ride->id] = _trackBlockLinksCurrentGeneration;
+    }
+
+    auto key = track_block_links_get_key(ride, tileElement);
+    auto& entry = links[tileElement];
+    if (entry.Key != key || entry.X != x || entry.Y != y)
+    {
+        entry = {};
+        entry.Key = key;
+        entry.X = x;
+        entry.Y = y;
+    }
+    return entry;
+}
+
+/**
+ * Same as track_block_get_next, but remembers the result for the given piece.
+ */
+bool track_block_get_next_cached(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    auto inputElement = input->element->AsTrack();
+    if (inputElement == nullptr)
+        return false;
+
+    auto ride = get_ride(inputElement->GetRideIndex());
+    if (ride == nullptr)
+        return false;
+
+    auto& links = track_block_links_get(ride, input->x, input->y, input->element);
+    if (links.HasNext && track_block_links_get_key(ride, links.Next.element) == links.NextKey)
+    {
+        *output = links.Next;
+        if (z != nullptr)
+            *z = links.NextZ;
+        if (direction != nullptr)
+            *direction = links.NextDirection;
+        return true;
+    }
+
+    int32_t nextZ = 0;
+    int32_t nextDirection = 0;
+    int32_t* outZ = z != nullptr ? z : &nextZ;
+    int32_t* outDirection = direction != nullptr ? direction : &nextDirection;
+    if (!track_block_get_next(input, output, outZ, outDirection))
+    {
+        links.HasNext = false;
+        return false;
+    }
+
+    links.HasNext = true;
+    links.Next = *output;
+    links.NextKey = track_block_links_get_key(ride, output->element);
+    links.NextZ = *outZ;
+    links.NextDirection = *outDirection;
+    return true;
+}
+
+/**
+ * Same as track_block_get_previous, but remembers the result for the given piece.
+ */
+bool track_block_get_previous_cached(int32_t x, int32_t y, TileElement* tileElement, track_begin_end* outTrackBeginEnd)
+{
+    auto trackElement = tileElement->AsTrack();
+    if (trackElement == nullptr)
+        return false;
+
+    auto ride = get_ride(trackElement->GetRideIndex());
+    if (ride == nullptr)
+        return false;
+
+    auto& links = track_block_links_get(ride, x, y, tileElement);
+    if (links.HasPrevious && track_block_links_get_key(ride, links.Previous.begin_element) == links.PreviousKey)
+    {
+        // end_element is never set by track_block_get_previous
+        outTrackBeginEnd->begin_x = links.Previous.begin_x;
+        outTrackBeginEnd->begin_y = links.Previous.begin_y;
+        outTrackBeginEnd->begin_z = links.Previous.begin_z;
+        outTrackBeginEnd->begin_direction = links.Previous.begin_direction;
+        outTrackBeginEnd->begin_element = links.Previous.begin_element;
+        outTrackBeginEnd->end_x = links.Previous.end_x;
+        outTrackBeginEnd->end_y = links.Previous.end_y;
+        outTrackBeginEnd->end_direction = links.Previous.end_direction;
+        return true;
+    }
+
+    if (!track_block_get_previous(x, y, tileElement, outTrackBeginEnd))
+    {
+        links.HasPrevious = false;
+        return false;
+    }
+
+    links.HasPrevious = true;
+    links.Previous = *outTrackBeginEnd;
+    links.PreviousKey = track_block_links_get_key(ride, outTrackBeginEnd->begin_element);
+    return true;
+}
+
+/**
+ * Drops all remembered track links. Needs to be called whenever tile elements are inserted, removed or replaced.
+ */
+void track_block_links_invalidate()
+{
+    _trackBlockLinksCurrentGeneration++;
+}
+
 /**
  *
  * Make sure to pass in the x and y of the start track element too.
@@ -2752,14 +2914,13 @@ Peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
 Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
 {
     uint32_t closestDistance, distance;
-    uint16_t spriteIndex;
     Peep *peep, *closestMechanic = nullptr;
 
     closestDistance = UINT_MAX;
-    FOR_ALL_STAFF (spriteIndex, peep)
+    bool isLocationInPark = map_is_location_in_park({ x, y });
+    for (auto spriteIndex : staff_index_get(STAFF_TYPE_MECHANIC))
     {
-        if (peep->staff_type != STAFF_TYPE_MECHANIC)
-            continue;
+        peep = GET_PEEP(spriteIndex);
 
         if (!forInspection)
         {
@@ -2780,7 +2941,7 @@ Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
                 continue;
         }
 
-        if (map_is_location_in_park({ x, y }))
+        if (isLocationInPark)
             if (!staff_is_location_in_patrol(peep, x & 0xFFE0, y & 0xFFE0))
                 continue;
 
@@ -6014,19 +6175,23 @@ bool Ride::IsBlockSectioned() const
 
 bool ride_has_any_track_elements(const Ride* ride)
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    for (auto tileIndex : ride_tile_index_get(ride->id))
     {
-        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-        if (it.element->AsTrack()->GetRideIndex() != ride->id)
-            continue;
-        if (it.element->IsGhost())
+        TileElement* tileElement = map_get_first_element_at(
+            tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL);
+        if (tileElement == nullptr)
             continue;
+        do
+        {
+            if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                continue;
+            if (tileElement->AsTrack()->GetRideIndex() != ride->id)
+                continue;
+            if (tileElement->IsGhost())
+                continue;
 
-        return true;
+            return true;
+        } while (!(tileElement++)->IsLastForTile());
     }
 
     return false;
@@ -7808,17 +7973,111 @@ void determine_ride_entrance_and_exit_locations()
 
 void ride_clear_leftover_entrances(Ride* ride)
 {
-    tile_element_iterator it;
+    for (auto tileIndex : ride_tile_index_get(ride->id))
+    {
+        int32_t x = tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL;
+        int32_t y = tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL;
+        bool removedElement;
+        do
+        {
+            removedElement = false;
+            TileElement* tileElement = map_get_first_element_at(x, y);
+            if (tileElement == nullptr)
+                break;
+            do
+            {
+                if (tileElement->GetType() == TILE_ELEMENT_TYPE_ENTRANCE
+                    && tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE
+                    && tileElement->AsEntrance()->GetRideIndex() == ride->id)
+                {
+                    // Removing the element moves the rest of the tile, start over
+                    tile_element_remove(tileElement);
+                    removedElement = true;
+                    break;
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        } while (removedElement);
+    }
+}
+
+/**
+ * The tiles that contain, or at some point contained, track or an entrance of each ride. Tiles are ordered
+ * the same way tile_element_iterator visits them, so looking through them finds the same elements a scan
+ * of the whole map would, in the same order. Rebuilt from the map whenever the tile elements are replaced.
+ */
+static std::set<uint32_t> _rideTileIndex[MAX_RIDES];
+static bool _rideTileIndexValid = false;
 
+static ride_id_t ride_tile_index_get_ride(const TileElement* tileElement)
+{
+    switch (tileElement->GetType())
+    {
+        case TILE_ELEMENT_TYPE_TRACK:
+            return tileElement->AsTrack()->GetRideIndex();
+        case TILE_ELEMENT_TYPE_ENTRANCE:
+            if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE)
+            {
+                return tileElement->AsEntrance()->GetRideIndex();
+            }
+            break;
+    }
+    return RIDE_ID_NULL;
+}
+
+static void ride_tile_index_rebuild()
+{
+    for (auto& tiles : _rideTileIndex)
+    {
+        tiles.clear();
+    }
+
+    tile_element_iterator it;
     tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
+    do
+    {
+        auto rideIndex = ride_tile_index_get_ride(it.element);
+        if (rideIndex < MAX_RIDES)
+        {
+            _rideTileIndex[rideIndex].insert(it.y * MAXIMUM_MAP_SIZE_TECHNICAL + it.x);
+        }
+    } while (tile_element_iterator_next(&it));
+    _rideTileIndexValid = true;
+}
+
+static const std::set<uint32_t>& ride_tile_index_get(ride_id_t rideIndex)
+{
+    static const std::set<uint32_t> NoTiles;
+    if (rideIndex >= MAX_RIDES)
+    {
+        return NoTiles;
+    }
+    if (!_rideTileIndexValid)
+    {
+        ride_tile_index_rebuild();
+    }
+    return _rideTileIndex[rideIndex];
+}
+
+/**
+ * Marks the ride tile index as out of date, it will be rebuilt from the map the next time it is used.
+ * Needs to be called whenever the tile elements are replaced as a whole, e.g. when a park is loaded.
+ */
+void ride_tile_index_invalidate()
+{
+    _rideTileIndexValid = false;
+}
+
+/**
+ * Adds the tile of a newly placed track or ride entrance element to the ride tile index.
+ */
+void ride_tile_index_add(const CoordsXY& loc, const TileElement* tileElement)
+{
+    if (_rideTileIndexValid)
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_ENTRANCE
-            && it.element->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE
-            && it.element->AsEntrance()->GetRideIndex() == ride->id)
+        auto rideIndex = ride_tile_index_get_ride(tileElement);
+        if (rideIndex < MAX_RIDES)
         {
-            tile_element_remove(it.element);
-            tile_element_iterator_restart_for_tile(&it);
+            _rideTileIndex[rideIndex].insert((loc.y / 32) * MAXIMUM_MAP_SIZE_TECHNICAL + (loc.x / 32));
         }
     }
 }
@@ -1219,6 +1219,10 @@ bool track_block_get_previous(int32_t x, int32_t y, TileElement* tileElement, tr
 bool track_block_get_previous_from_zero(
     int16_t x, int16_t y, int16_t z, Ride* ride, uint8_t direction, track_begin_end* outTrackBeginEnd);
 
+bool track_block_get_next_cached(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction);
+bool track_block_get_previous_cached(int32_t x, int32_t y, TileElement* tileElement, track_begin_end* outTrackBeginEnd);
+void track_block_links_invalidate();
+
 void ride_get_start_of_track(CoordsXYE* output);
 
 void window_ride_construction_update_active_elements();
@@ -1282,4 +1286,7 @@ void ride_action_modify(Ride* ride, int32_t modifyType, int32_t flags);
 void determine_ride_entrance_and_exit_locations();
 void ride_clear_leftover_entrances(Ride* ride);
 
+void ride_tile_index_invalidate();
+void ride_tile_index_add(const CoordsXY& loc, const TileElement* tileElement);
+
 #endif
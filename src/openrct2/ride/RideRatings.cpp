@@ -113,6 +113,10 @@ void ride_ratings_update_ride(const Ride& ride)
 /**
  *
  *  rct2: 0x006B5A2A
+ *
+ * Advances the ratings calculation by a single step, which keeps the cost per tick constant no matter how many rides
+ * or how much track the park has. The calculation state is part of the saved game and is sent to clients, so which
+ * ride is being rated on which tick must not change, otherwise saved games, replays and multiplayer go out of sync.
  */
 void ride_ratings_update_all()
 {
@@ -423,12 +427,8 @@ static void proximity_score_increment(int32_t type)
  */
 static void ride_ratings_score_close_proximity_in_direction(TileElement* inputTileElement, int32_t direction)
 {
-    int32_t x = gRideRatingsCalcData.proximity_x + CoordsDirectionDelta[direction].x;
-    int32_t y = gRideRatingsCalcData.proximity_y + CoordsDirectionDelta[direction].y;
-    if (x < 0 || y < 0 || x >= (32 * 256) || y >= (32 * 256))
-        return;
-
-    TileElement* tileElement = map_get_first_element_at(x >> 5, y >> 5);
+    CoordsXY loc = { gRideRatingsCalcData.proximity_x, gRideRatingsCalcData.proximity_y };
+    TileElement* tileElement = map_get_first_element_at_neighbour(loc, direction);
     if (tileElement == nullptr)
         return;
     do
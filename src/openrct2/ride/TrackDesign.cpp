@@ -31,6 +31,7 @@
 #include "../core/File.h"
 #include "../core/String.hpp"
 #include "../drawing/X8DrawingEngine.h"
+#include "../interface/Viewport.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
@@ -2233,6 +2234,11 @@ static void track_design_preview_restore_map(map_backup* backup)
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
+    viewport_hit_test_clear();
+    ride_tile_index_invalidate();
+    track_block_links_invalidate();
+    park_size_invalidate();
+    map_active_tiles_invalidate();
 
     free(backup);
 }
@@ -0,0 +1,90 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackPaintTable.h"
+
+#include "../paint/Paint.h"
+#include "../paint/Supports.h"
+#include "../paint/tile_element/Paint.TileElement.h"
+#include "TrackPaint.h"
+
+void track_paint_table_paint(
+    paint_session* session, const TrackPaintPiece& piece, uint8_t trackSequence, uint8_t direction, int32_t height)
+{
+    if (trackSequence >= piece.NumSequences)
+    {
+        return;
+    }
+
+    const auto& sequence = piece.Sequences[trackSequence];
+    const uint8_t directionBit = 1 << direction;
+    for (size_t i = 0; i < sequence.NumRecords; i++)
+    {
+        const auto& record = sequence.Records[i];
+        if (!(record.Directions & directionBit))
+        {
+            continue;
+        }
+        if ((record.Flags & TRACK_PAINT_FLAG_ALTERNATE_TILES) && !track_paint_util_should_paint_supports(session->MapPosition))
+        {
+            continue;
+        }
+
+        switch (record.Type)
+        {
+            case TRACK_PAINT_RECORD_98196C:
+                sub_98196C_rotated(
+                    session, direction, record.Values[direction] | session->TrackColours[record.Scheme], record.OffsetX,
+                    record.OffsetY, record.BoundLengthX, record.BoundLengthY, record.BoundLengthZ, height + record.Height);
+                break;
+            case TRACK_PAINT_RECORD_98197C:
+                sub_98197C_rotated(
+                    session, direction, record.Values[direction] | session->TrackColours[record.Scheme], record.OffsetX,
+                    record.OffsetY, record.BoundLengthX, record.BoundLengthY, record.BoundLengthZ, height + record.Height,
+                    record.BoundOffsetX, record.BoundOffsetY, height + record.BoundOffsetZ);
+                break;
+            case TRACK_PAINT_RECORD_98199C:
+                sub_98199C_rotated(
+                    session, direction, record.Values[direction] | session->TrackColours[record.Scheme], record.OffsetX,
+                    record.OffsetY, record.BoundLengthX, record.BoundLengthY, record.BoundLengthZ, height + record.Height,
+                    record.BoundOffsetX, record.BoundOffsetY, height + record.BoundOffsetZ);
+                break;
+            case TRACK_PAINT_RECORD_SEGMENT_SUPPORT_HEIGHT:
+            {
+                auto segments = paint_util_rotate_segments(record.Values[0], direction);
+                if (record.Flags & TRACK_PAINT_FLAG_BLOCK_SEGMENTS)
+                {
+                    paint_util_set_segment_support_height(session, segments, 0xFFFF, 0);
+                }
+                else
+                {
+                    paint_util_set_segment_support_height(session, segments, height + record.Height, record.Param);
+                }
+                break;
+            }
+            case TRACK_PAINT_RECORD_GENERAL_SUPPORT_HEIGHT:
+                paint_util_set_general_support_height(session, height + record.Height, record.Param);
+                break;
+            case TRACK_PAINT_RECORD_METAL_A_SUPPORTS:
+                metal_a_supports_paint_setup(
+                    session, record.Kind, record.Values[direction], record.Param, height + record.Height,
+                    session->TrackColours[record.Scheme]);
+                break;
+            case TRACK_PAINT_RECORD_TUNNEL:
+                paint_util_push_tunnel_rotated(session, direction, height + record.Height, record.Kind);
+                break;
+            case TRACK_PAINT_RECORD_TUNNEL_LEFT:
+                paint_util_push_tunnel_left(session, height + record.Height, record.Kind);
+                break;
+            case TRACK_PAINT_RECORD_TUNNEL_RIGHT:
+                paint_util_push_tunnel_right(session, height + record.Height, record.Kind);
+                break;
+        }
+    }
+}
@@ -0,0 +1,212 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/TileElement.h"
+
+#include <array>
+
+struct paint_session;
+
+/**
+ * Track pieces can be painted from tables instead of a paint function per piece. Each sequence of a piece has a list of
+ * records that are interpreted in order, records only apply to the directions in their direction mask. Sprites,
+ * segments and tunnels are given for the piece facing direction 0 and rotated like the *_rotated paint helpers do,
+ * heights are relative to the track element.
+ */
+enum TRACK_PAINT_RECORD_TYPE : uint8_t
+{
+    TRACK_PAINT_RECORD_98196C,
+    TRACK_PAINT_RECORD_98197C,
+    TRACK_PAINT_RECORD_98199C,
+    TRACK_PAINT_RECORD_SEGMENT_SUPPORT_HEIGHT,
+    TRACK_PAINT_RECORD_GENERAL_SUPPORT_HEIGHT,
+    TRACK_PAINT_RECORD_METAL_A_SUPPORTS,
+    TRACK_PAINT_RECORD_TUNNEL,
+    TRACK_PAINT_RECORD_TUNNEL_LEFT,
+    TRACK_PAINT_RECORD_TUNNEL_RIGHT,
+};
+
+enum
+{
+    // Only painted on the tiles track_paint_util_should_paint_supports returns true for.
+    TRACK_PAINT_FLAG_ALTERNATE_TILES = (1 << 0),
+    // The segments are set to 0xFFFF so that no supports are painted on them.
+    TRACK_PAINT_FLAG_BLOCK_SEGMENTS = (1 << 1),
+};
+
+struct TrackPaintRecord
+{
+    uint8_t Type;
+    // Bit n is set if the record is painted for direction n.
+    uint8_t Directions;
+    uint8_t Flags;
+    // The colour scheme of sprites and supports.
+    uint8_t Scheme;
+    // The support type of supports and the tunnel type of tunnels.
+    uint8_t Kind;
+    // The slope of support heights and the special value of supports.
+    int16_t Param;
+    // Indexed by direction, the image ids of sprites and the support segments of supports. The segments of segment
+    // support heights are stored in the first value.
+    std::array<uint32_t, 4> Values;
+    int16_t Height;
+    int8_t OffsetX;
+    int8_t OffsetY;
+    int16_t BoundLengthX;
+    int16_t BoundLengthY;
+    int8_t BoundLengthZ;
+    int16_t BoundOffsetX;
+    int16_t BoundOffsetY;
+    int16_t BoundOffsetZ;
+};
+
+struct TrackPaintSequence
+{
+    const TrackPaintRecord* Records = nullptr;
+    size_t NumRecords = 0;
+
+    constexpr TrackPaintSequence() = default;
+    template<size_t N>
+    constexpr TrackPaintSequence(const TrackPaintRecord (&records)[N])
+        : Records(records)
+        , NumRecords(N)
+    {
+    }
+};
+
+struct TrackPaintPiece
+{
+    track_type_t TrackType;
+    const TrackPaintSequence* Sequences;
+    size_t NumSequences;
+
+    template<size_t N>
+    constexpr TrackPaintPiece(track_type_t trackType, const TrackPaintSequence (&sequences)[N])
+        : TrackType(trackType)
+        , Sequences(sequences)
+        , NumSequences(N)
+    {
+    }
+};
+
+/**
+ * Looks up the pieces of a table by track type. Built at compile time from the list of pieces.
+ */
+struct TrackPaintTable
+{
+    // Every track type, as in TrackDefinitions.
+    std::array<const TrackPaintPiece*, 256> Pieces{};
+
+    template<size_t N> constexpr TrackPaintTable(const TrackPaintPiece (&pieces)[N])
+    {
+        for (const auto& piece : pieces)
+        {
+            Pieces[piece.TrackType] = &piece;
+        }
+    }
+};
+
+constexpr TrackPaintRecord track_paint_sprite(
+    uint8_t type, uint8_t directions, uint8_t scheme, std::array<uint32_t, 4> imageIds, int8_t offsetX, int8_t offsetY,
+    int16_t lengthX, int16_t lengthY, int8_t lengthZ, int16_t zOffset, int16_t boundOffsetX, int16_t boundOffsetY,
+    int16_t boundOffsetZ)
+{
+    return { type, directions, 0, scheme, 0, 0, imageIds, zOffset, offsetX, offsetY, lengthX, lengthY, lengthZ, boundOffsetX,
+             boundOffsetY, boundOffsetZ };
+}
+
+constexpr TrackPaintRecord track_paint_record(
+    uint8_t type, uint8_t directions, uint8_t flags, uint8_t scheme, uint8_t kind, int16_t param,
+    std::array<uint32_t, 4> values, int16_t height)
+{
+    return { type, directions, flags, scheme, kind, param, values, height, 0, 0, 0, 0, 0, 0, 0, 0 };
+}
+
+constexpr TrackPaintRecord track_paint_98196c(
+    uint8_t directions, uint8_t scheme, std::array<uint32_t, 4> imageIds, int8_t offsetX, int8_t offsetY, int16_t lengthX,
+    int16_t lengthY, int8_t lengthZ, int16_t zOffset)
+{
+    return track_paint_sprite(
+        TRACK_PAINT_RECORD_98196C, directions, scheme, imageIds, offsetX, offsetY, lengthX, lengthY, lengthZ, zOffset, 0, 0, 0);
+}
+
+constexpr TrackPaintRecord track_paint_98197c(
+    uint8_t directions, uint8_t scheme, std::array<uint32_t, 4> imageIds, int8_t offsetX, int8_t offsetY, int16_t lengthX,
+    int16_t lengthY, int8_t lengthZ, int16_t zOffset, int16_t boundOffsetX, int16_t boundOffsetY, int16_t boundOffsetZ)
+{
+    return track_paint_sprite(
+        TRACK_PAINT_RECORD_98197C, directions, scheme, imageIds, offsetX, offsetY, lengthX, lengthY, lengthZ, zOffset,
+        boundOffsetX, boundOffsetY, boundOffsetZ);
+}
+
+constexpr TrackPaintRecord track_paint_98199c(
+    uint8_t directions, uint8_t scheme, std::array<uint32_t, 4> imageIds, int8_t offsetX, int8_t offsetY, int16_t lengthX,
+    int16_t lengthY, int8_t lengthZ, int16_t zOffset, int16_t boundOffsetX, int16_t boundOffsetY, int16_t boundOffsetZ)
+{
+    return track_paint_sprite(
+        TRACK_PAINT_RECORD_98199C, directions, scheme, imageIds, offsetX, offsetY, lengthX, lengthY, lengthZ, zOffset,
+        boundOffsetX, boundOffsetY, boundOffsetZ);
+}
+
+constexpr TrackPaintRecord track_paint_segment_support_height(
+    uint8_t directions, uint16_t segments, int16_t height, uint8_t slope)
+{
+    return track_paint_record(
+        TRACK_PAINT_RECORD_SEGMENT_SUPPORT_HEIGHT, directions, 0, 0, 0, slope, { segments, 0, 0, 0 }, height);
+}
+
+constexpr TrackPaintRecord track_paint_block_segments(uint8_t directions, uint16_t segments)
+{
+    return track_paint_record(
+        TRACK_PAINT_RECORD_SEGMENT_SUPPORT_HEIGHT, directions, TRACK_PAINT_FLAG_BLOCK_SEGMENTS, 0, 0, 0,
+        { segments, 0, 0, 0 }, 0);
+}
+
+constexpr TrackPaintRecord track_paint_general_support_height(uint8_t directions, int16_t height, uint8_t slope)
+{
+    return track_paint_record(TRACK_PAINT_RECORD_GENERAL_SUPPORT_HEIGHT, directions, 0, 0, 0, slope, {}, height);
+}
+
+constexpr TrackPaintRecord track_paint_metal_a_supports(
+    uint8_t directions, uint8_t flags, uint8_t supportType, std::array<uint32_t, 4> segments, int16_t special, int16_t height,
+    uint8_t scheme)
+{
+    return track_paint_record(
+        TRACK_PAINT_RECORD_METAL_A_SUPPORTS, directions, flags, scheme, supportType, special, segments, height);
+}
+
+constexpr TrackPaintRecord track_paint_tunnel(uint8_t directions, int16_t height, uint8_t tunnelType)
+{
+    return track_paint_record(TRACK_PAINT_RECORD_TUNNEL, directions, 0, 0, tunnelType, 0, {}, height);
+}
+
+constexpr TrackPaintRecord track_paint_tunnel_left(uint8_t directions, int16_t height, uint8_t tunnelType)
+{
+    return track_paint_record(TRACK_PAINT_RECORD_TUNNEL_LEFT, directions, 0, 0, tunnelType, 0, {}, height);
+}
+
+constexpr TrackPaintRecord track_paint_tunnel_right(uint8_t directions, int16_t height, uint8_t tunnelType)
+{
+    return track_paint_record(TRACK_PAINT_RECORD_TUNNEL_RIGHT, directions, 0, 0, tunnelType, 0, {}, height);
+}
+
+inline const TrackPaintPiece* track_paint_table_find(const TrackPaintTable& table, int32_t trackType)
+{
+    if (trackType < 0 || trackType >= (int32_t)table.Pieces.size())
+    {
+        return nullptr;
+    }
+    return table.Pieces[trackType];
+}
+
+void track_paint_table_paint(
+    paint_session* session, const TrackPaintPiece& piece, uint8_t trackSequence, uint8_t direction, int32_t height);
@@ -1343,6 +1343,10 @@ void vehicle_update_all()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gS6Info.editor_step != EDITOR_STEP_ROLLERCOASTER_DESIGNER)
         return;
 
+    // Trains have to be updated one after the other in sprite list order. Even trains of unrelated rides share the
+    // scenario random number generator, the sprite spatial index (sprite_move), the guests they load and unload and
+    // the motion scratch state below (gCurrentVehicle, _vehicleMotionTrackFlags, ...), so any other order changes
+    // the outcome and desynchronises multiplayer games and replays.
     sprite_index = gSpriteListHead[SPRITE_LIST_VEHICLE_HEAD];
     while (sprite_index != SPRITE_INDEX_NULL)
     {
@@ -7885,7 +7889,7 @@ static void sub_6DBF3E(rct_vehicle* vehicle)
             input.x = vehicle->track_x;
             input.y = vehicle->track_y;
             input.element = tileElement;
-            if (!track_block_get_next(&input, &output, &outputZ, &outputDirection))
+            if (!track_block_get_next_cached(&input, &output, &outputZ, &outputDirection))
             {
                 _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
             }
@@ -7996,7 +8000,7 @@ static bool vehicle_update_track_motion_forwards_get_new_track(
 loc_6DB32A:
 {
     track_begin_end trackBeginEnd;
-    if (!track_block_get_previous(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
+    if (!track_block_get_previous_cached(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
     {
         return false;
     }
@@ -8015,7 +8019,7 @@ loc_6DB358:
     xyElement.x = vehicle->track_x;
     xyElement.y = vehicle->track_y;
     xyElement.element = tileElement;
-    if (!track_block_get_next(&xyElement, &xyElement, &z, &direction))
+    if (!track_block_get_next_cached(&xyElement, &xyElement, &z, &direction))
     {
         return false;
     }
@@ -8411,7 +8415,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
     {
         // loc_6DBB7E:;
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous(x, y, tileElement, &trackBeginEnd))
+        if (!track_block_get_previous_cached(x, y, tileElement, &trackBeginEnd))
         {
             return false;
         }
@@ -8458,7 +8462,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
         input.x = x;
         input.y = y;
         input.element = tileElement;
-        if (!track_block_get_next(&input, &output, &outputZ, &direction))
+        if (!track_block_get_next_cached(&input, &output, &outputZ, &direction))
         {
             return false;
         }
@@ -8848,7 +8852,7 @@ loc_6DC476:
         input.x = vehicle->track_x;
         input.y = vehicle->track_y;
         input.element = tileElement;
-        if (!track_block_get_next(&input, &output, &outZ, &outDirection))
+        if (!track_block_get_next_cached(&input, &output, &outZ, &outDirection))
         {
             goto loc_6DC9BC;
         }
@@ -9097,7 +9101,7 @@ loc_6DCA9A:
     }
     {
         track_begin_end trackBeginEnd;
-        if (!track_block_get_previous(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
+        if (!track_block_get_previous_cached(vehicle->track_x, vehicle->track_y, tileElement, &trackBeginEnd))
         {
             goto loc_6DC9BC;
         }
@@ -9929,14 +9933,14 @@ void vehicle_update_crossings(const rct_vehicle* vehicle)
 
             if (travellingForwards)
             {
-                if (!track_block_get_next(&xyElement, &xyElement, &z, &direction))
+                if (!track_block_get_next_cached(&xyElement, &xyElement, &z, &direction))
                 {
                     break;
                 }
             }
             else
             {
-                if (!track_block_get_previous(xyElement.x, xyElement.y, xyElement.element, &output))
+                if (!track_block_get_previous_cached(xyElement.x, xyElement.y, xyElement.element, &output))
                 {
                     break;
                 }
@@ -9968,7 +9972,7 @@ void vehicle_update_crossings(const rct_vehicle* vehicle)
         {
             if (travellingForwards)
             {
-                if (track_block_get_previous(xyElement.x, xyElement.y, xyElement.element, &output))
+                if (track_block_get_previous_cached(xyElement.x, xyElement.y, xyElement.element, &output))
                 {
                     xyElement.x = output.begin_x;
                     xyElement.y = output.begin_y;
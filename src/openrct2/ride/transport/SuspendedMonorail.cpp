@@ -18,38 +18,7 @@
 #include "../RideData.h"
 #include "../TrackData.h"
 #include "../TrackPaint.h"
-
-/** rct2: 0x008636F4 */
-static void suspended_monorail_track_flat(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25853, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 32);
-            break;
-        case 1:
-        case 3:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25854, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 32);
-            break;
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (track_paint_util_should_paint_supports(session->MapPosition))
-    {
-        metal_a_supports_paint_setup(session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-    }
-
-    paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-    paint_util_set_general_support_height(session, height + 48, 0x20);
-}
+#include "../TrackPaintTable.h"
 
 /** rct2: 0x008637A4, 0x008637B4, 0x008637C4 */
 static void suspended_monorail_track_station(
@@ -78,1803 +47,752 @@ static void suspended_monorail_track_station(
     paint_util_set_general_support_height(session, height + 48, 0x20);
 }
 
-/** rct2: 0x00863704 */
-static void suspended_monorail_track_25_deg_up(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (direction)
-    {
-        case 0:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25945, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 48);
-            break;
-        case 1:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25946, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 48);
-            break;
-        case 2:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25947, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 48);
-            break;
-        case 3:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25948, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 48);
-            break;
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (track_paint_util_should_paint_supports(session->MapPosition))
-    {
-        switch (direction)
-        {
-            case 0:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 6, 0, height + 60, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 8, 0, height + 60, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 7, 0, height + 60, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 5, 0, height + 60, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
+/** rct2: 0x008636F4 */
+static constexpr const TrackPaintRecord SuspendedMonorailFlatSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25853, 25854, 25853, 25854 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1111, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailFlat[] = { SuspendedMonorailFlatSeq0 };
 
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_7);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_8);
-    }
-    paint_util_set_general_support_height(session, height + 72, 0x20);
-}
+/** rct2: 0x00863704 */
+static constexpr const TrackPaintRecord SuspendedMonorail25DegUpSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25945, 25946, 25947, 25948 }, 0, 0, 32, 20, 3, 32, 0, 6, 48),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 6, 8, 7, 5 }, 0, 60, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, -8, TUNNEL_7),
+    track_paint_tunnel(0b0110, 8, TUNNEL_8),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorail25DegUp[] = { SuspendedMonorail25DegUpSeq0 };
 
 /** rct2: 0x00863714 */
-static void suspended_monorail_track_flat_to_25_deg_up(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (direction)
-    {
-        case 0:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25937, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 1:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25938, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 2:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25939, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 3:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25940, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (track_paint_util_should_paint_supports(session->MapPosition))
-    {
-        switch (direction)
-        {
-            case 0:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 6, 0, height + 52, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 8, 0, height + 52, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 7, 0, height + 52, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 5, 0, height + 52, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_8);
-    }
-    paint_util_set_general_support_height(session, height + 64, 0x20);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailFlatTo25DegUpSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25937, 25938, 25939, 25940 }, 0, 0, 32, 20, 3, 32, 0, 6, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 6, 8, 7, 5 }, 0, 52, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_tunnel(0b0110, 0, TUNNEL_8),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailFlatTo25DegUp[] = { SuspendedMonorailFlatTo25DegUpSeq0 };
 
 /** rct2: 0x00863724 */
-static void suspended_monorail_track_25_deg_up_to_flat(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (direction)
-    {
-        case 0:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25941, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 1:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25942, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 2:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25943, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-        case 3:
-            sub_98197C_rotated(
-                session, direction, session->TrackColours[SCHEME_TRACK] | 25944, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                height + 40);
-            break;
-    }
-
-    paint_util_set_segment_support_height(
-        session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (track_paint_util_should_paint_supports(session->MapPosition))
-    {
-        switch (direction)
-        {
-            case 0:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 6, 0, height + 50, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 8, 0, height + 50, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 7, 0, height + 50, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                metal_a_supports_paint_setup(
-                    session, METAL_SUPPORTS_BOXED, 5, 0, height + 50, session->TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_9);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_15);
-    }
-    paint_util_set_general_support_height(session, height + 56, 0x20);
-}
+static constexpr const TrackPaintRecord SuspendedMonorail25DegUpToFlatSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25941, 25942, 25943, 25944 }, 0, 0, 32, 20, 3, 32, 0, 6, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 6, 8, 7, 5 }, 0, 50, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, -8, TUNNEL_9),
+    track_paint_tunnel(0b0110, 8, TUNNEL_15),
+    track_paint_general_support_height(0b1111, 56, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorail25DegUpToFlat[] = { SuspendedMonorail25DegUpToFlatSeq0 };
 
 /** rct2: 0x00863734 */
-static void suspended_monorail_track_25_deg_down(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    suspended_monorail_track_25_deg_up(session, rideIndex, trackSequence, (direction + 2) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorail25DegDownSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25947, 25948, 25945, 25946 }, 0, 0, 32, 20, 3, 32, 0, 6, 48),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 7, 5, 6, 8 }, 0, 60, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 8, TUNNEL_8),
+    track_paint_tunnel(0b0110, -8, TUNNEL_7),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorail25DegDown[] = { SuspendedMonorail25DegDownSeq0 };
 
 /** rct2: 0x00863744 */
-static void suspended_monorail_track_flat_to_25_deg_down(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    suspended_monorail_track_25_deg_up_to_flat(session, rideIndex, trackSequence, (direction + 2) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailFlatTo25DegDownSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25943, 25944, 25941, 25942 }, 0, 0, 32, 20, 3, 32, 0, 6, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 7, 5, 6, 8 }, 0, 50, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 8, TUNNEL_15),
+    track_paint_tunnel(0b0110, -8, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 56, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailFlatTo25DegDown[] = { SuspendedMonorailFlatTo25DegDownSeq0 };
 
 /** rct2: 0x00863754 */
-static void suspended_monorail_track_25_deg_down_to_flat(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    suspended_monorail_track_flat_to_25_deg_up(session, rideIndex, trackSequence, (direction + 2) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorail25DegDownToFlatSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25939, 25940, 25937, 25938 }, 0, 0, 32, 20, 3, 32, 0, 6, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(
+        0b1111, TRACK_PAINT_FLAG_ALTERNATE_TILES, METAL_SUPPORTS_BOXED, { 7, 5, 6, 8 }, 0, 52, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_8),
+    track_paint_tunnel(0b0110, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorail25DegDownToFlat[] = { SuspendedMonorail25DegDownToFlatSeq0 };
 
 /** rct2: 0x00863764 */
-static void suspended_monorail_track_left_quarter_turn_5(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25876, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25881, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25886, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25871, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25875, 0, 0, 32, 16, 3, height + 32);
-                    break;
-                case 1:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25880, 0, 0, 32, 16, 3, height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25885, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25870, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25874, 0, 0, 16, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25879, 0, 0, 16, 16, 3, height + 32, 16, 16,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25884, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25869, 0, 0, 16, 16, 3, height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 4:
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 5:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25873, 0, 0, 16, 32, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25878, 0, 0, 16, 32, 3, height + 32);
-                    break;
-                case 2:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25883, 0, 0, 16, 32, 3, height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25868, 0, 0, 16, 32, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B8 | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 6:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25872, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25877, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25882, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25867, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            switch (direction)
-            {
-                case 2:
-                    paint_util_push_tunnel_right(session, height, TUNNEL_9);
-                    break;
-                case 3:
-                    paint_util_push_tunnel_left(session, height, TUNNEL_9);
-                    break;
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25876, 25881, 25886, 25871 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq1[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq2[] = {
+    track_paint_98196c(0b0011, SCHEME_TRACK, { 25875, 25880, 0, 0 }, 0, 0, 32, 16, 3, 32),
+    track_paint_98197c(0b1100, SCHEME_TRACK, { 0, 0, 25885, 25870 }, 0, 0, 32, 16, 3, 32, 0, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq3[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25874, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25879, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25884, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98196c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25869 }, 0, 0, 16, 16, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq4[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq5[] = {
+    track_paint_98197c(0b1001, SCHEME_TRACK, { 25873, 0, 0, 25868 }, 0, 0, 16, 32, 3, 32, 16, 0, 32),
+    track_paint_98196c(0b0110, SCHEME_TRACK, { 0, 25878, 25883, 0 }, 0, 0, 16, 32, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn5TilesSeq6[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25872, 25877, 25882, 25867 }, 0, 0, 20, 32, 3, 32, 6, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel_right(0b0100, 0, TUNNEL_9),
+    track_paint_tunnel_left(0b1000, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailLeftQuarterTurn5Tiles[] = {
+    SuspendedMonorailLeftQuarterTurn5TilesSeq0,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq1,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq2,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq3,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq4,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq5,
+    SuspendedMonorailLeftQuarterTurn5TilesSeq6,
+};
 
 /** rct2: 0x00863774 */
-static void suspended_monorail_track_right_quarter_turn_5(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    trackSequence = mapLeftQuarterTurn5TilesToRightQuarterTurn5Tiles[trackSequence];
-    suspended_monorail_track_left_quarter_turn_5(session, rideIndex, trackSequence, (direction - 1) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25867, 25872, 25877, 25882 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq1[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq2[] = {
+    track_paint_98197c(0b0011, SCHEME_TRACK, { 25868, 25873, 0, 0 }, 0, 0, 32, 16, 3, 32, 0, 16, 32),
+    track_paint_98196c(0b1100, SCHEME_TRACK, { 0, 0, 25878, 25883 }, 0, 0, 32, 16, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq3[] = {
+    track_paint_98196c(0b0001, SCHEME_TRACK, { 25869, 0, 0, 0 }, 0, 0, 16, 16, 3, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25874, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25879, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25884 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq4[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq5[] = {
+    track_paint_98197c(0b1001, SCHEME_TRACK, { 25870, 0, 0, 25885 }, 0, 0, 16, 32, 3, 32, 16, 0, 32),
+    track_paint_98196c(0b0110, SCHEME_TRACK, { 0, 25875, 25880, 0 }, 0, 0, 16, 32, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn5TilesSeq6[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25871, 25876, 25881, 25886 }, 0, 0, 20, 32, 3, 32, 6, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel_right(0b0001, 0, TUNNEL_9),
+    track_paint_tunnel_left(0b0010, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailRightQuarterTurn5Tiles[] = {
+    SuspendedMonorailRightQuarterTurn5TilesSeq0,
+    SuspendedMonorailRightQuarterTurn5TilesSeq1,
+    SuspendedMonorailRightQuarterTurn5TilesSeq2,
+    SuspendedMonorailRightQuarterTurn5TilesSeq3,
+    SuspendedMonorailRightQuarterTurn5TilesSeq4,
+    SuspendedMonorailRightQuarterTurn5TilesSeq5,
+    SuspendedMonorailRightQuarterTurn5TilesSeq6,
+};
 
 /** rct2: 0x00863784 */
-static void suspended_monorail_track_s_bend_left(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25919, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25923, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25922, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25926, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25920, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 1:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25924, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25921, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25925, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 5, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 6, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25921, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25925, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25920, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 3:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25924, 0, 0, 32, 26, 3, height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 5, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 6, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25922, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25926, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25919, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25923, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            switch (direction)
-            {
-                case 1:
-                    paint_util_push_tunnel_right(session, height, TUNNEL_9);
-                    break;
-                case 2:
-                    paint_util_push_tunnel_left(session, height, TUNNEL_9);
-                    break;
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailSBendLeftSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25919, 25923, 25922, 25926 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendLeftSeq1[] = {
+    track_paint_98196c(0b0011, SCHEME_TRACK, { 25920, 25924, 0, 0 }, 0, 0, 32, 26, 3, 32),
+    track_paint_98197c(0b1100, SCHEME_TRACK, { 0, 0, 25921, 25925 }, 0, 0, 32, 26, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b0011, 0, METAL_SUPPORTS_BOXED, { 5, 6, 0, 0 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendLeftSeq2[] = {
+    track_paint_98197c(0b0011, SCHEME_TRACK, { 25921, 25925, 0, 0 }, 0, 0, 32, 26, 3, 32, 0, 6, 32),
+    track_paint_98196c(0b1100, SCHEME_TRACK, { 0, 0, 25920, 25924 }, 0, 0, 32, 26, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1100, 0, METAL_SUPPORTS_BOXED, { 0, 0, 5, 6 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendLeftSeq3[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25922, 25926, 25919, 25923 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b0110, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailSBendLeft[] = {
+    SuspendedMonorailSBendLeftSeq0,
+    SuspendedMonorailSBendLeftSeq1,
+    SuspendedMonorailSBendLeftSeq2,
+    SuspendedMonorailSBendLeftSeq3,
+};
 
 /** rct2: 0x00863794 */
-static void suspended_monorail_track_s_bend_right(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25927, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25931, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25930, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25934, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25928, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25932, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25929, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 3:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25933, 0, 0, 32, 26, 3, height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 8, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 7, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25929, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 1:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25933, 0, 0, 32, 26, 3, height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25928, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25932, 0, 0, 32, 26, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 8, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 7, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25930, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25934, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25927, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25931, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            switch (direction)
-            {
-                case 1:
-                    paint_util_push_tunnel_right(session, height, TUNNEL_9);
-                    break;
-                case 2:
-                    paint_util_push_tunnel_left(session, height, TUNNEL_9);
-                    break;
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailSBendRightSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25927, 25931, 25930, 25934 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendRightSeq1[] = {
+    track_paint_98197c(0b0011, SCHEME_TRACK, { 25928, 25932, 0, 0 }, 0, 0, 32, 26, 3, 32, 0, 6, 32),
+    track_paint_98196c(0b1100, SCHEME_TRACK, { 0, 0, 25929, 25933 }, 0, 0, 32, 26, 3, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b0011, 0, METAL_SUPPORTS_BOXED, { 8, 7, 0, 0 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendRightSeq2[] = {
+    track_paint_98196c(0b0011, SCHEME_TRACK, { 25929, 25933, 0, 0 }, 0, 0, 32, 26, 3, 32),
+    track_paint_98197c(0b1100, SCHEME_TRACK, { 0, 0, 25928, 25932 }, 0, 0, 32, 26, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1100, 0, METAL_SUPPORTS_BOXED, { 0, 0, 8, 7 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailSBendRightSeq3[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25930, 25934, 25927, 25931 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b0110, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailSBendRight[] = {
+    SuspendedMonorailSBendRightSeq0,
+    SuspendedMonorailSBendRightSeq1,
+    SuspendedMonorailSBendRightSeq2,
+    SuspendedMonorailSBendRightSeq3,
+};
 
 /** rct2: 0x008637D4 */
-static void suspended_monorail_track_left_quarter_turn_3(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25860, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25863, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25866, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25857, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25859, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98196C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25862, 0, 0, 16, 16, 3, height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25865, 0, 0, 16, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25856, 0, 0, 16, 16, 3, height + 32, 16, 16,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25858, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25861, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25864, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25855, 0, 0, 20, 32, 3, height + 32, 6, 0,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            switch (direction)
-            {
-                case 2:
-                    paint_util_push_tunnel_right(session, height, TUNNEL_9);
-                    break;
-                case 3:
-                    paint_util_push_tunnel_left(session, height, TUNNEL_9);
-                    break;
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn3TilesSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25860, 25863, 25866, 25857 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn3TilesSeq1[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn3TilesSeq2[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25859, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98196c(0b0010, SCHEME_TRACK, { 0, 25862, 0, 0 }, 0, 0, 16, 16, 3, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25865, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25856 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftQuarterTurn3TilesSeq3[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25858, 25861, 25864, 25855 }, 0, 0, 20, 32, 3, 32, 6, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel_right(0b0100, 0, TUNNEL_9),
+    track_paint_tunnel_left(0b1000, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailLeftQuarterTurn3Tiles[] = {
+    SuspendedMonorailLeftQuarterTurn3TilesSeq0,
+    SuspendedMonorailLeftQuarterTurn3TilesSeq1,
+    SuspendedMonorailLeftQuarterTurn3TilesSeq2,
+    SuspendedMonorailLeftQuarterTurn3TilesSeq3,
+};
 
 /** rct2: 0x008637E4 */
-static void suspended_monorail_track_right_quarter_turn_3(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    trackSequence = mapLeftQuarterTurn3TilesToRightQuarterTurn3Tiles[trackSequence];
-    suspended_monorail_track_left_quarter_turn_3(session, rideIndex, trackSequence, (direction - 1) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn3TilesSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25855, 25858, 25861, 25864 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn3TilesSeq1[] = {
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn3TilesSeq2[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25856, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25859, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98196c(0b0100, SCHEME_TRACK, { 0, 0, 25862, 0 }, 0, 0, 16, 16, 3, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25865 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightQuarterTurn3TilesSeq3[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25857, 25860, 25863, 25866 }, 0, 0, 20, 32, 3, 32, 6, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel_right(0b0001, 0, TUNNEL_9),
+    track_paint_tunnel_left(0b0010, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailRightQuarterTurn3Tiles[] = {
+    SuspendedMonorailRightQuarterTurn3TilesSeq0,
+    SuspendedMonorailRightQuarterTurn3TilesSeq1,
+    SuspendedMonorailRightQuarterTurn3TilesSeq2,
+    SuspendedMonorailRightQuarterTurn3TilesSeq3,
+};
 
 /** rct2: 0x00863864 */
-static void suspended_monorail_track_left_eighth_to_diag(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25903, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25907, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25911, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25915, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25904, 0, 0, 32, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25908, 0, 0, 34, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25912, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25916, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25905, 0, 0, 16, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25909, 0, 0, 16, 16, 3, height + 32, 16, 16,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25913, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25917, 0, 0, 16, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 4:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25906, 0, 0, 16, 16, 3, height + 32, 16, 16,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25910, 0, 0, 16, 18, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25914, 0, 0, 16, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25918, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToDiagSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25903, 25907, 25911, 25915 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToDiagSeq1[] = {
+    track_paint_98197c(0b1100, SCHEME_TRACK, { 0, 0, 25912, 25916 }, 0, 0, 32, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25904, 0, 0, 0 }, 0, 0, 32, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25908, 0, 0 }, 0, 0, 34, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToDiagSeq2[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25905, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25909, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25913, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25917 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToDiagSeq3[] = {
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToDiagSeq4[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25906, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25910, 0, 0 }, 0, 0, 16, 18, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25914, 0 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25918 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 3, 1, 0, 2 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailLeftEighthToDiag[] = {
+    SuspendedMonorailLeftEighthToDiagSeq0,
+    SuspendedMonorailLeftEighthToDiagSeq1,
+    SuspendedMonorailLeftEighthToDiagSeq2,
+    SuspendedMonorailLeftEighthToDiagSeq3,
+    SuspendedMonorailLeftEighthToDiagSeq4,
+};
 
 /** rct2: 0x00863874 */
-static void suspended_monorail_track_right_eighth_to_diag(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25887, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25891, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25895, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25899, 0, 0, 32, 20, 3, height + 32, 0, 6,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            metal_a_supports_paint_setup(
-                session, METAL_SUPPORTS_BOXED, 4, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-
-            if (direction == 0 || direction == 3)
-            {
-                paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_9);
-            }
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25888, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25892, 0, 0, 32, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25896, 0, 0, 34, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25900, 0, 0, 32, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25889, 0, 0, 16, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25893, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25897, 0, 0, 28, 28, 3, height + 32, 4, 4,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25901, 0, 0, 16, 16, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction),
-                0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 4:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25890, 0, 0, 16, 16, 3, height + 32, 16, 0,
-                        height + 32);
-                    break;
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25894, 0, 0, 16, 16, 3, height + 32, 0, 0,
-                        height + 32);
-                    break;
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25898, 0, 0, 16, 18, 3, height + 32, 0, 16,
-                        height + 32);
-                    break;
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25902, 0, 0, 16, 16, 3, height + 32, 16, 16,
-                        height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session,
-                paint_util_rotate_segments(
-                    SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4, direction),
-                0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToDiagSeq0[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25887, 25891, 25895, 25899 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b1001, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToDiagSeq1[] = {
+    track_paint_98197c(0b0011, SCHEME_TRACK, { 25888, 25892, 0, 0 }, 0, 0, 32, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25896, 0 }, 0, 0, 34, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25900 }, 0, 0, 32, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToDiagSeq2[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25889, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25893, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25897, 0 }, 0, 0, 28, 28, 3, 32, 4, 4, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25901 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToDiagSeq3[] = {
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToDiagSeq4[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25890, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25894, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25898, 0 }, 0, 0, 16, 18, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25902 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 3 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailRightEighthToDiag[] = {
+    SuspendedMonorailRightEighthToDiagSeq0,
+    SuspendedMonorailRightEighthToDiagSeq1,
+    SuspendedMonorailRightEighthToDiagSeq2,
+    SuspendedMonorailRightEighthToDiagSeq3,
+    SuspendedMonorailRightEighthToDiagSeq4,
+};
 
 /** rct2: 0x00863884 */
-static void suspended_monorail_track_left_eighth_to_orthogonal(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    trackSequence = mapLeftEighthTurnToOrthogonal[trackSequence];
-    suspended_monorail_track_right_eighth_to_diag(session, rideIndex, trackSequence, (direction + 2) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToOrthogonalSeq0[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25898, 0, 0, 0 }, 0, 0, 16, 18, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25902, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25890, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25894 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 2, 3, 1, 0 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToOrthogonalSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25897, 0, 0, 0 }, 0, 0, 28, 28, 3, 32, 4, 4, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25901, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25889, 0 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25893 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToOrthogonalSeq2[] = {
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToOrthogonalSeq3[] = {
+    track_paint_98197c(0b1100, SCHEME_TRACK, { 0, 0, 25888, 25892 }, 0, 0, 32, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25896, 0, 0, 0 }, 0, 0, 34, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25900, 0, 0 }, 0, 0, 32, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailLeftEighthToOrthogonalSeq4[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25895, 25899, 25887, 25891 }, 0, 0, 32, 20, 3, 32, 0, 6, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel(0b0110, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailLeftEighthToOrthogonal[] = {
+    SuspendedMonorailLeftEighthToOrthogonalSeq0,
+    SuspendedMonorailLeftEighthToOrthogonalSeq1,
+    SuspendedMonorailLeftEighthToOrthogonalSeq2,
+    SuspendedMonorailLeftEighthToOrthogonalSeq3,
+    SuspendedMonorailLeftEighthToOrthogonalSeq4,
+};
 
 /** rct2: 0x00863894 */
-static void suspended_monorail_track_right_eighth_to_orthogonal(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    trackSequence = mapLeftEighthTurnToOrthogonal[trackSequence];
-    suspended_monorail_track_left_eighth_to_diag(session, rideIndex, trackSequence, (direction + 3) & 3, height, tileElement);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToOrthogonalSeq0[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25918, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25906, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25910, 0 }, 0, 0, 18, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25914 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 2, 3, 1, 0 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToOrthogonalSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25917, 0, 0, 0 }, 0, 0, 16, 16, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25905, 0, 0 }, 0, 0, 16, 16, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25909, 0 }, 0, 0, 16, 16, 3, 32, 16, 16, 32),
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25913 }, 0, 0, 16, 16, 3, 32, 0, 16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_BC | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToOrthogonalSeq2[] = {
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToOrthogonalSeq3[] = {
+    track_paint_98197c(0b1001, SCHEME_TRACK, { 25916, 0, 0, 25912 }, 0, 0, 16, 32, 3, 32, 16, 0, 32),
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25904, 0, 0 }, 0, 0, 16, 32, 3, 32, 0, 0, 32),
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25908, 0 }, 0, 0, 16, 34, 3, 32, 0, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailRightEighthToOrthogonalSeq4[] = {
+    track_paint_98197c(0b1111, SCHEME_TRACK, { 25915, 25903, 25907, 25911 }, 0, 0, 20, 32, 3, 32, 6, 0, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D4),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 4, 4, 4, 4 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_tunnel_right(0b0001, 0, TUNNEL_9),
+    track_paint_tunnel_left(0b0010, 0, TUNNEL_9),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailRightEighthToOrthogonal[] = {
+    SuspendedMonorailRightEighthToOrthogonalSeq0,
+    SuspendedMonorailRightEighthToOrthogonalSeq1,
+    SuspendedMonorailRightEighthToOrthogonalSeq2,
+    SuspendedMonorailRightEighthToOrthogonalSeq3,
+    SuspendedMonorailRightEighthToOrthogonalSeq4,
+};
 
 /** rct2: 0x008637F4 */
-static void suspended_monorail_track_diag_flat(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25936, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25935, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25935, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 32);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25936, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 32);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 42, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 48, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25936 }, -16, -16, 32, 32, 3, 32, -16, -16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25935, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25935, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25936, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 32),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 3 }, 0, 42, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 48, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiagFlat[] = {
+    SuspendedMonorailDiagFlatSeq0,
+    SuspendedMonorailDiagFlatSeq1,
+    SuspendedMonorailDiagFlatSeq2,
+    SuspendedMonorailDiagFlatSeq3,
+};
 
 /** rct2: 0x00863824 */
-static void suspended_monorail_track_diag_25_deg_up(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25960, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25957, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25959, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25958, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 55, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 55, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 55, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 57, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25960 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25957, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25959, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25958, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b0111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 0 }, 0, 55, SCHEME_SUPPORTS),
+    track_paint_metal_a_supports(0b1000, 0, METAL_SUPPORTS_BOXED, { 0, 0, 0, 3 }, 0, 57, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiag25DegUp[] = {
+    SuspendedMonorailDiag25DegUpSeq0,
+    SuspendedMonorailDiag25DegUpSeq1,
+    SuspendedMonorailDiag25DegUpSeq2,
+    SuspendedMonorailDiag25DegUpSeq3,
+};
 
 /** rct2: 0x00863804 */
-static void suspended_monorail_track_diag_flat_to_25_deg_up(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25952, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25949, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25951, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25950, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 50, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegUpSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25952 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegUpSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25949, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegUpSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25951, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegUpSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25950, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b0111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 0 }, 0, 48, SCHEME_SUPPORTS),
+    track_paint_metal_a_supports(0b1000, 0, METAL_SUPPORTS_BOXED, { 0, 0, 0, 3 }, 0, 50, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiagFlatTo25DegUp[] = {
+    SuspendedMonorailDiagFlatTo25DegUpSeq0,
+    SuspendedMonorailDiagFlatTo25DegUpSeq1,
+    SuspendedMonorailDiagFlatTo25DegUpSeq2,
+    SuspendedMonorailDiagFlatTo25DegUpSeq3,
+};
 
 /** rct2: 0x00863814 */
-static void suspended_monorail_track_diag_25_deg_up_to_flat(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25956, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25953, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25955, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25954, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 51, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 51, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 51, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 51, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpToFlatSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25956 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpToFlatSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25953, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpToFlatSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25955, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegUpToFlatSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25954, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 3 }, 0, 51, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiag25DegUpToFlat[] = {
+    SuspendedMonorailDiag25DegUpToFlatSeq0,
+    SuspendedMonorailDiag25DegUpToFlatSeq1,
+    SuspendedMonorailDiag25DegUpToFlatSeq2,
+    SuspendedMonorailDiag25DegUpToFlatSeq3,
+};
 
 /** rct2: 0x00863854 */
-static void suspended_monorail_track_diag_25_deg_down(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25958, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25959, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25957, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25960, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 48);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 54, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 54, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 51, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 58, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 72, 0x20);
-            break;
-    }
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25958 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25959, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25957, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25960, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 48),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b0011, 0, METAL_SUPPORTS_BOXED, { 1, 0, 0, 0 }, 0, 54, SCHEME_SUPPORTS),
+    track_paint_metal_a_supports(0b0100, 0, METAL_SUPPORTS_BOXED, { 0, 0, 2, 0 }, 0, 51, SCHEME_SUPPORTS),
+    track_paint_metal_a_supports(0b1000, 0, METAL_SUPPORTS_BOXED, { 0, 0, 0, 3 }, 0, 58, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiag25DegDown[] = {
+    SuspendedMonorailDiag25DegDownSeq0,
+    SuspendedMonorailDiag25DegDownSeq1,
+    SuspendedMonorailDiag25DegDownSeq2,
+    SuspendedMonorailDiag25DegDownSeq3,
+};
 
 /** rct2: 0x00863834 */
-static void suspended_monorail_track_diag_flat_to_25_deg_down(
-    paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TileElement* tileElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25954, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25955, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25953, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25956, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 48, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-            break;
-    }
-
-    paint_util_set_general_support_height(session, height + 72, 0x20);
-}
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegDownSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25954 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegDownSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25955, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegDownSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25953, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiagFlatTo25DegDownSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25956, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 3 }, 0, 48, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 72, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiagFlatTo25DegDown[] = {
+    SuspendedMonorailDiagFlatTo25DegDownSeq0,
+    SuspendedMonorailDiagFlatTo25DegDownSeq1,
+    SuspendedMonorailDiagFlatTo25DegDownSeq2,
+    SuspendedMonorailDiagFlatTo25DegDownSeq3,
+};
 
 /** rct2: 0x00863844 */
-static void suspended_monorail_track_diag_25_deg_down_to_flat(
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownToFlatSeq0[] = {
+    track_paint_98197c(0b1000, SCHEME_TRACK, { 0, 0, 0, 25950 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownToFlatSeq1[] = {
+    track_paint_98197c(0b0001, SCHEME_TRACK, { 25951, 0, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownToFlatSeq2[] = {
+    track_paint_98197c(0b0100, SCHEME_TRACK, { 0, 0, 25949, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintRecord SuspendedMonorailDiag25DegDownToFlatSeq3[] = {
+    track_paint_98197c(0b0010, SCHEME_TRACK, { 0, 25952, 0, 0 }, -16, -16, 32, 32, 3, 32, -16, -16, 40),
+    track_paint_block_segments(0b1111, SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0),
+    track_paint_metal_a_supports(0b1111, 0, METAL_SUPPORTS_BOXED, { 1, 0, 2, 3 }, 0, 46, SCHEME_SUPPORTS),
+    track_paint_general_support_height(0b1111, 64, 0x20),
+};
+static constexpr const TrackPaintSequence SuspendedMonorailDiag25DegDownToFlat[] = {
+    SuspendedMonorailDiag25DegDownToFlatSeq0,
+    SuspendedMonorailDiag25DegDownToFlatSeq1,
+    SuspendedMonorailDiag25DegDownToFlatSeq2,
+    SuspendedMonorailDiag25DegDownToFlatSeq3,
+};
+static constexpr const TrackPaintPiece SuspendedMonorailPieces[] = {
+    { TRACK_ELEM_FLAT, SuspendedMonorailFlat },
+    { TRACK_ELEM_25_DEG_UP, SuspendedMonorail25DegUp },
+    { TRACK_ELEM_FLAT_TO_25_DEG_UP, SuspendedMonorailFlatTo25DegUp },
+    { TRACK_ELEM_25_DEG_UP_TO_FLAT, SuspendedMonorail25DegUpToFlat },
+    { TRACK_ELEM_25_DEG_DOWN, SuspendedMonorail25DegDown },
+    { TRACK_ELEM_FLAT_TO_25_DEG_DOWN, SuspendedMonorailFlatTo25DegDown },
+    { TRACK_ELEM_25_DEG_DOWN_TO_FLAT, SuspendedMonorail25DegDownToFlat },
+    { TRACK_ELEM_LEFT_QUARTER_TURN_5_TILES, SuspendedMonorailLeftQuarterTurn5Tiles },
+    { TRACK_ELEM_RIGHT_QUARTER_TURN_5_TILES, SuspendedMonorailRightQuarterTurn5Tiles },
+    { TRACK_ELEM_S_BEND_LEFT, SuspendedMonorailSBendLeft },
+    { TRACK_ELEM_S_BEND_RIGHT, SuspendedMonorailSBendRight },
+    { TRACK_ELEM_LEFT_QUARTER_TURN_3_TILES, SuspendedMonorailLeftQuarterTurn3Tiles },
+    { TRACK_ELEM_RIGHT_QUARTER_TURN_3_TILES, SuspendedMonorailRightQuarterTurn3Tiles },
+    { TRACK_ELEM_LEFT_EIGHTH_TO_DIAG, SuspendedMonorailLeftEighthToDiag },
+    { TRACK_ELEM_RIGHT_EIGHTH_TO_DIAG, SuspendedMonorailRightEighthToDiag },
+    { TRACK_ELEM_LEFT_EIGHTH_TO_ORTHOGONAL, SuspendedMonorailLeftEighthToOrthogonal },
+    { TRACK_ELEM_RIGHT_EIGHTH_TO_ORTHOGONAL, SuspendedMonorailRightEighthToOrthogonal },
+    { TRACK_ELEM_DIAG_FLAT, SuspendedMonorailDiagFlat },
+    { TRACK_ELEM_DIAG_25_DEG_UP, SuspendedMonorailDiag25DegUp },
+    { TRACK_ELEM_DIAG_FLAT_TO_25_DEG_UP, SuspendedMonorailDiagFlatTo25DegUp },
+    { TRACK_ELEM_DIAG_25_DEG_UP_TO_FLAT, SuspendedMonorailDiag25DegUpToFlat },
+    { TRACK_ELEM_DIAG_25_DEG_DOWN, SuspendedMonorailDiag25DegDown },
+    { TRACK_ELEM_DIAG_FLAT_TO_25_DEG_DOWN, SuspendedMonorailDiagFlatTo25DegDown },
+    { TRACK_ELEM_DIAG_25_DEG_DOWN_TO_FLAT, SuspendedMonorailDiag25DegDownToFlat },
+};
+static constexpr const TrackPaintTable SuspendedMonorailTable(SuspendedMonorailPieces);
+
+static void suspended_monorail_track_paint(
     paint_session* session, ride_id_t rideIndex, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TileElement* tileElement)
 {
-    switch (trackSequence)
+    auto piece = track_paint_table_find(SuspendedMonorailTable, tileElement->AsTrack()->GetTrackType());
+    if (piece != nullptr)
     {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25950, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_BC | SEGMENT_C4 | SEGMENT_CC | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25951, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B4 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25949, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_C0 | SEGMENT_C4 | SEGMENT_D0 | SEGMENT_D4, direction), 0xFFFF, 0);
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 1:
-                    sub_98197C_rotated(
-                        session, direction, session->TrackColours[SCHEME_TRACK] | 25952, -16, -16, 32, 32, 3, height + 32, -16,
-                        -16, height + 40);
-                    break;
-            }
-
-            paint_util_set_segment_support_height(
-                session, paint_util_rotate_segments(SEGMENT_B8 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_D0, direction), 0xFFFF, 0);
-            switch (direction)
-            {
-                case 0:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 1, 0, height + 46, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 1:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 0, 0, height + 46, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 2:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 2, 0, height + 46, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-                case 3:
-                    metal_a_supports_paint_setup(
-                        session, METAL_SUPPORTS_BOXED, 3, 0, height + 46, session->TrackColours[SCHEME_SUPPORTS]);
-                    break;
-            }
-
-            paint_util_set_general_support_height(session, height + 64, 0x20);
-            break;
+        track_paint_table_paint(session, *piece, trackSequence, direction, height);
     }
 }
 
@@ -1882,58 +800,14 @@ TRACK_PAINT_FUNCTION get_track_paint_function_suspended_monorail(int32_t trackTy
 {
     switch (trackType)
     {
-        case TRACK_ELEM_FLAT:
-            return suspended_monorail_track_flat;
         case TRACK_ELEM_END_STATION:
         case TRACK_ELEM_BEGIN_STATION:
         case TRACK_ELEM_MIDDLE_STATION:
             return suspended_monorail_track_station;
-        case TRACK_ELEM_25_DEG_UP:
-            return suspended_monorail_track_25_deg_up;
-        case TRACK_ELEM_FLAT_TO_25_DEG_UP:
-            return suspended_monorail_track_flat_to_25_deg_up;
-        case TRACK_ELEM_25_DEG_UP_TO_FLAT:
-            return suspended_monorail_track_25_deg_up_to_flat;
-        case TRACK_ELEM_25_DEG_DOWN:
-            return suspended_monorail_track_25_deg_down;
-        case TRACK_ELEM_FLAT_TO_25_DEG_DOWN:
-            return suspended_monorail_track_flat_to_25_deg_down;
-        case TRACK_ELEM_25_DEG_DOWN_TO_FLAT:
-            return suspended_monorail_track_25_deg_down_to_flat;
-        case TRACK_ELEM_LEFT_QUARTER_TURN_5_TILES:
-            return suspended_monorail_track_left_quarter_turn_5;
-        case TRACK_ELEM_RIGHT_QUARTER_TURN_5_TILES:
-            return suspended_monorail_track_right_quarter_turn_5;
-        case TRACK_ELEM_S_BEND_LEFT:
-            return suspended_monorail_track_s_bend_left;
-        case TRACK_ELEM_S_BEND_RIGHT:
-            return suspended_monorail_track_s_bend_right;
-        case TRACK_ELEM_LEFT_QUARTER_TURN_3_TILES:
-            return suspended_monorail_track_left_quarter_turn_3;
-        case TRACK_ELEM_RIGHT_QUARTER_TURN_3_TILES:
-            return suspended_monorail_track_right_quarter_turn_3;
-        case TRACK_ELEM_LEFT_EIGHTH_TO_DIAG:
-            return suspended_monorail_track_left_eighth_to_diag;
-        case TRACK_ELEM_RIGHT_EIGHTH_TO_DIAG:
-            return suspended_monorail_track_right_eighth_to_diag;
-        case TRACK_ELEM_LEFT_EIGHTH_TO_ORTHOGONAL:
-            return suspended_monorail_track_left_eighth_to_orthogonal;
-        case TRACK_ELEM_RIGHT_EIGHTH_TO_ORTHOGONAL:
-            return suspended_monorail_track_right_eighth_to_orthogonal;
-        case TRACK_ELEM_DIAG_FLAT:
-            return suspended_monorail_track_diag_flat;
-        case TRACK_ELEM_DIAG_25_DEG_UP:
-            return suspended_monorail_track_diag_25_deg_up;
-        case TRACK_ELEM_DIAG_FLAT_TO_25_DEG_UP:
-            return suspended_monorail_track_diag_flat_to_25_deg_up;
-        case TRACK_ELEM_DIAG_25_DEG_UP_TO_FLAT:
-            return suspended_monorail_track_diag_25_deg_up_to_flat;
-        case TRACK_ELEM_DIAG_25_DEG_DOWN:
-            return suspended_monorail_track_diag_25_deg_down;
-        case TRACK_ELEM_DIAG_FLAT_TO_25_DEG_DOWN:
-            return suspended_monorail_track_diag_flat_to_25_deg_down;
-        case TRACK_ELEM_DIAG_25_DEG_DOWN_TO_FLAT:
-            return suspended_monorail_track_diag_25_deg_down_to_flat;
+    }
+    if (track_paint_table_find(SuspendedMonorailTable, trackType) != nullptr)
+    {
+        return suspended_monorail_track_paint;
     }
     return nullptr;
 }
@@ -29,6 +29,7 @@
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../interface/Cursors.h"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -56,6 +57,7 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -109,6 +111,17 @@ LocationXYZ16 gCommandPosition;
 
 bool gMapLandRightsUpdateSuccess;
 
+// Width and height of the blocks of tiles whose elements are stored together by map_reorganise_elements.
+static constexpr int32_t TILE_ELEMENT_BLOCK_SIZE = 8;
+
+/**
+ * One bit per tile, set for tiles that may contain a footpath or small scenery, the only elements the periodic tile
+ * sweeps (map_update_tiles, map_update_path_wide_flags) act on. Inserting an element on a tile sets its bit, bits are
+ * only cleared when the bitmap is rebuilt from the map. A clear bit means the sweeps have nothing to do on the tile.
+ */
+static std::array<uint64_t, MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL / 64> _mapActiveTiles;
+static bool _mapActiveTilesValid = false;
+
 static void clear_elements_at(const CoordsXY& loc);
 static ScreenCoordsXY translate_3d_to_2d(int32_t rotation, const CoordsXY& pos);
 
@@ -191,6 +204,21 @@ TileElement* map_get_first_element_at(int32_t x, int32_t y)
     return gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
 }
 
+/**
+ * Gets the first element of the tile next to the given location in the given direction, including diagonal directions,
+ * or nullptr when that tile is outside of the map.
+ */
+TileElement* map_get_first_element_at_neighbour(const CoordsXY& loc, int32_t direction)
+{
+    int32_t x = (loc.x >> 5) + TileDirectionDelta[direction].x;
+    int32_t y = (loc.y >> 5) + TileDirectionDelta[direction].y;
+    if (x < 0 || y < 0 || x > (MAXIMUM_MAP_SIZE_TECHNICAL - 1) || y > (MAXIMUM_MAP_SIZE_TECHNICAL - 1))
+    {
+        return nullptr;
+    }
+    return gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+}
+
 TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n)
 {
     TileElement* tileElement = map_get_first_element_at(x, y);
@@ -422,6 +450,56 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    viewport_hit_test_clear();
+    ride_tile_index_invalidate();
+    track_block_links_invalidate();
+    park_size_invalidate();
+    map_active_tiles_invalidate();
+}
+
+static void map_active_tiles_set(int32_t x, int32_t y)
+{
+    uint32_t index = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    _mapActiveTiles[index / 64] |= 1ULL << (index % 64);
+}
+
+static void map_active_tiles_rebuild()
+{
+    _mapActiveTiles.fill(0);
+
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    do
+    {
+        auto type = it.element->GetType();
+        if (type == TILE_ELEMENT_TYPE_PATH || type == TILE_ELEMENT_TYPE_SMALL_SCENERY)
+        {
+            map_active_tiles_set(it.x, it.y);
+        }
+    } while (tile_element_iterator_next(&it));
+    _mapActiveTilesValid = true;
+}
+
+/**
+ * Whether the tile may contain a footpath or small scenery, see _mapActiveTiles.
+ */
+static bool map_is_tile_active(int32_t x, int32_t y)
+{
+    if (!_mapActiveTilesValid)
+    {
+        map_active_tiles_rebuild();
+    }
+    uint32_t index = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    return (_mapActiveTiles[index / 64] & (1ULL << (index % 64))) != 0;
+}
+
+/**
+ * Marks the active tile bitmap as out of date, it will be rebuilt from the map the next time it is used.
+ * Needs to be called whenever the tile elements are replaced as a whole, e.g. when a park is loaded.
+ */
+void map_active_tiles_invalidate()
+{
+    _mapActiveTilesValid = false;
 }
 
 /**
@@ -655,7 +733,11 @@ void map_update_path_wide_flags()
     uint16_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
     {
-        footpath_update_path_wide_flags(x, y);
+        // Only tiles with footpaths have wide flags to update
+        if (map_is_tile_active(x / 32, y / 32))
+        {
+            footpath_update_path_wide_flags(x, y);
+        }
 
         // Next x, y tile
         x += 32;
@@ -967,6 +1049,8 @@ void tile_element_remove(TileElement* tileElement)
     {
         gNextFreeTileElement--;
     }
+    viewport_hit_test_clear();
+    track_block_links_invalidate();
 }
 
 /**
@@ -1077,9 +1161,14 @@ void map_invalidate_selection_rect()
 /**
  *
  *  rct2: 0x0068B111
+ *
+ * Compacts the tile elements row by row. With the blocked_tile_elements option they are stored in blocks of
+ * TILE_ELEMENT_BLOCK_SIZE x TILE_ELEMENT_BLOCK_SIZE tiles instead, so that the elements of neighbouring tiles are close
+ * together in memory. Saved games always store the elements row by row, see S6Exporter::ExportTileElements.
  */
 void map_reorganise_elements()
 {
+    viewport_hit_test_clear();
     context_setcurrentcursor(CURSOR_ZZZ);
 
     TileElement* new_tile_elements = (TileElement*)malloc(
@@ -1094,20 +1183,29 @@ void map_reorganise_elements()
 
     uint32_t num_elements;
 
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    // A single block covering the whole map gives the original row by row order
+    int32_t blockSize = gConfigGeneral.blocked_tile_elements ? TILE_ELEMENT_BLOCK_SIZE : MAXIMUM_MAP_SIZE_TECHNICAL;
+    for (int32_t blockY = 0; blockY < MAXIMUM_MAP_SIZE_TECHNICAL; blockY += blockSize)
     {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        for (int32_t blockX = 0; blockX < MAXIMUM_MAP_SIZE_TECHNICAL; blockX += blockSize)
         {
-            TileElement* startElement = map_get_first_element_at(x, y);
-            if (startElement == nullptr)
-                continue;
-            TileElement* endElement = startElement;
-            while (!(endElement++)->IsLastForTile())
-                ;
-
-            num_elements = (uint32_t)(endElement - startElement);
-            std::memcpy(new_elements_pointer, startElement, num_elements * sizeof(TileElement));
-            new_elements_pointer += num_elements;
+            for (int32_t y = blockY; y < blockY + blockSize; y++)
+            {
+                for (int32_t x = blockX; x < blockX + blockSize; x++)
+                {
+                    TileElement* startElement = map_get_first_element_at(x, y);
+                    if (startElement == nullptr)
+                        continue;
+                    TileElement* endElement = startElement;
+                    while (!(endElement++)->IsLastForTile())
+                        ;
+
+                    num_elements = (uint32_t)(endElement - startElement);
+                    std::memcpy(new_elements_pointer, startElement, num_elements * sizeof(TileElement));
+                    map_set_tile_elements(x, y, gTileElements + (new_elements_pointer - new_tile_elements));
+                    new_elements_pointer += num_elements;
+                }
+            }
         }
     }
 
@@ -1119,7 +1217,11 @@ void map_reorganise_elements()
 
     free(new_tile_elements);
 
-    map_update_tile_pointers();
+    gNextFreeTileElement = gTileElements + num_elements;
+    ride_tile_index_invalidate();
+    track_block_links_invalidate();
+    park_size_invalidate();
+    map_active_tiles_invalidate();
 }
 
 /**
@@ -1219,6 +1321,12 @@ TileElement* tile_element_insert(const TileCoordsXYZ& loc, int32_t occupiedQuadr
     }
 
     gNextFreeTileElement = newTileElement;
+    viewport_hit_test_clear();
+    track_block_links_invalidate();
+    if (_mapActiveTilesValid)
+    {
+        map_active_tiles_set(loc.x, loc.y);
+    }
     return insertedElement;
 }
 
@@ -1503,7 +1611,10 @@ void map_update_tiles()
         if (surfaceElement != nullptr)
         {
             surfaceElement->UpdateGrassLength({ x * 32, y * 32 });
-            scenery_update_tile(x * 32, y * 32);
+            if (map_is_tile_active(x, y))
+            {
+                scenery_update_tile(x * 32, y * 32);
+            }
         }
 
         gGrassSceneryTileLoopPosition++;
@@ -138,7 +138,9 @@ void map_init(int32_t size);
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
+void map_active_tiles_invalidate();
 TileElement* map_get_first_element_at(int32_t x, int32_t y);
+TileElement* map_get_first_element_at_neighbour(const CoordsXY& loc, int32_t direction);
 TileElement* map_get_nth_element_at(int32_t x, int32_t y, int32_t n);
 void map_set_tile_elements(int32_t x, int32_t y, TileElement* elements);
 int32_t map_height_from_slope(const CoordsXY& coords, int32_t slope, bool isSloped);
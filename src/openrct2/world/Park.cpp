@@ -17,6 +17,7 @@
 #include "../OpenRCT2.h"
 #include "../actions/ParkSetParameterAction.hpp"
 #include "../config/Config.h"
+#include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../interface/Colour.h"
 #include "../interface/Window.h"
@@ -44,6 +45,11 @@
 
 using namespace OpenRCT2;
 
+// The number of tiles counted by Park::CalculateParkSize, kept up to date as surface ownership changes. Anything that
+// replaces the map wholesale invalidates it and it is counted again the next time it is needed.
+static int32_t _ownedTileCount;
+static bool _ownedTileCountValid;
+
 uint32_t gParkFlags;
 uint16_t gParkRating;
 money16 gParkEntranceFee;
@@ -325,7 +331,7 @@ void Park::Update(const Date& date)
     // Every ~102 seconds
     if (gCurrentTicks % 4096 == 0)
     {
-        gParkSize = CalculateParkSize();
+        gParkSize = GetParkSize();
         window_invalidate_by_class(WC_PARK_INFORMATION);
     }
     // Every new week
@@ -336,6 +342,23 @@ void Park::Update(const Date& date)
     GenerateGuests();
 }
 
+int32_t Park::GetParkSize() const
+{
+    if (!_ownedTileCountValid)
+    {
+        _ownedTileCount = CalculateParkSize();
+        _ownedTileCountValid = true;
+    }
+#ifdef DEBUG
+    else
+    {
+        auto tiles = CalculateParkSize();
+        Guard::Assert(tiles == _ownedTileCount, "Park size out of sync: counted %d, expected %d", tiles, _ownedTileCount);
+    }
+#endif
+    return _ownedTileCount;
+}
+
 int32_t Park::CalculateParkSize() const
 {
     int32_t tiles;
@@ -792,7 +815,7 @@ int32_t park_is_open()
 
 int32_t park_calculate_size()
 {
-    auto tiles = GetContext()->GetGameState()->GetPark().CalculateParkSize();
+    auto tiles = GetContext()->GetGameState()->GetPark().GetParkSize();
     if (tiles != gParkSize)
     {
         gParkSize = tiles;
@@ -801,6 +824,20 @@ int32_t park_calculate_size()
     return tiles;
 }
 
+void park_size_invalidate()
+{
+    _ownedTileCountValid = false;
+}
+
+void park_size_ownership_changed(uint8_t oldOwnership, uint8_t newOwnership)
+{
+    if (_ownedTileCountValid)
+    {
+        constexpr uint8_t ownedMask = OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED;
+        _ownedTileCount += ((newOwnership & ownedMask) != 0) - ((oldOwnership & ownedMask) != 0);
+    }
+}
+
 uint8_t calculate_guest_initial_happiness(uint8_t percentage)
 {
     return Park::CalculateGuestInitialHappiness(percentage);
@@ -67,6 +67,7 @@ namespace OpenRCT2
         void Initialise();
         void Update(const Date& date);
 
+        int32_t GetParkSize() const;
         int32_t CalculateParkSize() const;
         int32_t CalculateParkRating() const;
         money32 CalculateParkValue() const;
@@ -113,6 +114,8 @@ int32_t get_forced_park_rating();
 
 int32_t park_is_open();
 int32_t park_calculate_size();
+void park_size_invalidate();
+void park_size_ownership_changed(uint8_t oldOwnership, uint8_t newOwnership);
 
 void update_park_fences(CoordsXY coords);
 void update_park_fences_around_tile(CoordsXY coords);
@@ -18,6 +18,7 @@
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
+#include "../peep/Staff.h"
 #include "../scenario/Scenario.h"
 #include "Fountain.h"
 
@@ -187,6 +188,7 @@ void reset_sprite_list()
     gSpriteListCount[SPRITE_LIST_FREE] = MAX_SPRITES;
 
     reset_sprite_spatial_index();
+    staff_index_invalidate();
 }
 
 /**
@@ -462,6 +464,12 @@ void move_sprite_to_list(rct_sprite* sprite, SPRITE_LIST newListIndex)
     // Decrement old list counter, increment new list counter.
     gSpriteListCount[oldListIndex]--;
     gSpriteListCount[newListIndex]++;
+
+    // New peeps go to the front of the list, which changes the order of the staff in it
+    if (newListIndex == SPRITE_LIST_PEEP)
+    {
+        staff_index_invalidate();
+    }
 }
 
 /**
@@ -15,6 +15,7 @@
 #include "../scenario/Scenario.h"
 #include "Location.hpp"
 #include "Map.h"
+#include "Park.h"
 
 uint32_t SurfaceElement::GetSurfaceStyle() const
 {
@@ -185,6 +186,7 @@ uint8_t SurfaceElement::GetOwnership() const
 
 void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
+    park_size_ownership_changed(GetOwnership(), newOwnership);
     Ownership &= ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK;
     Ownership |= (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
 }
@@ -157,6 +157,10 @@ GameActionResult::Ptr tile_inspector_remove_element_at(CoordsXY loc, int16_t ele
         {
             return std::make_unique<GameActionResult>(GA_ERROR::UNKNOWN, STR_NONE);
         }
+        if (tileElement->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            park_size_ownership_changed(tileElement->AsSurface()->GetOwnership(), OWNERSHIP_UNOWNED);
+        }
         tile_element_remove(tileElement);
         map_invalidate_tile_full(loc.x, loc.y);
 
@@ -327,6 +331,11 @@ GameActionResult::Ptr tile_inspector_paste_element_at(CoordsXY loc, TileElement
         bool lastForTile = pastedElement->IsLastForTile();
         *pastedElement = element;
         pastedElement->SetLastForTile(lastForTile);
+        ride_tile_index_add(loc, pastedElement);
+        if (pastedElement->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            park_size_ownership_changed(OWNERSHIP_UNOWNED, pastedElement->AsSurface()->GetOwnership());
+        }
 
         map_invalidate_tile_full(loc.x, loc.y);
 
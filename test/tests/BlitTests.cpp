@@ -0,0 +1,169 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+using BlitTransparentFunction = void (*)(int32_t, const uint8_t*, uint8_t*);
+using BlitSampleFunction = void (*)(int32_t, int32_t, const uint8_t*, uint8_t*);
+using BlitRemapFunction = void (*)(int32_t, const uint8_t*, uint8_t*, const uint8_t*);
+
+class BlitTests : public testing::Test
+{
+protected:
+    // Runs of every length up to a few vector widths, starting at every alignment within a vector
+    static constexpr int32_t MAX_RUN_LENGTH = 160;
+    static constexpr int32_t MAX_ALIGNMENT = 32;
+
+    std::vector<uint8_t> _src;
+    std::vector<uint8_t> _dst;
+    // Large enough for the 64K entry table of a transparent palette, a remap palette only uses the first 256 entries
+    std::vector<uint8_t> _palette;
+
+    void SetUp() override
+    {
+        std::mt19937 rng(0);
+        _src.resize(MAX_ALIGNMENT + MAX_RUN_LENGTH);
+        for (auto& pixel : _src)
+        {
+            // Plenty of transparent pixels, as in actual sprites
+            pixel = (rng() % 4 == 0) ? 0 : (uint8_t)rng();
+        }
+        // The first few entries are looked up differently, make sure they come up
+        _dst.resize(MAX_ALIGNMENT + MAX_RUN_LENGTH);
+        for (auto& pixel : _dst)
+        {
+            pixel = (rng() % 4 == 0) ? (uint8_t)(rng() % 3) : (uint8_t)rng();
+        }
+        _palette.resize(256 * 256);
+        for (auto& entry : _palette)
+        {
+            entry = (uint8_t)rng();
+        }
+    }
+
+    void CheckTransparent(BlitTransparentFunction fn)
+    {
+        for (int32_t alignment = 0; alignment < MAX_ALIGNMENT; alignment++)
+        {
+            for (int32_t width = 0; width <= MAX_RUN_LENGTH; width++)
+            {
+                // Start from a non-empty destination, transparent pixels must keep it
+                std::vector<uint8_t> expected(MAX_ALIGNMENT + MAX_RUN_LENGTH, 0xAA);
+                std::vector<uint8_t> actual = expected;
+                blit_transparent_scalar(width, &_src[alignment], &expected[alignment]);
+                fn(width, &_src[alignment], &actual[alignment]);
+                ASSERT_EQ(expected, actual) << "width " << width << ", alignment " << alignment;
+            }
+        }
+    }
+
+    void CheckSample(BlitSampleFunction fn)
+    {
+        for (int32_t zoom = 0; zoom <= MAX_ZOOM_LEVEL; zoom++)
+        {
+            for (int32_t alignment = 0; alignment < MAX_ALIGNMENT; alignment++)
+            {
+                for (int32_t width = 0; width <= MAX_RUN_LENGTH; width++)
+                {
+                    std::vector<uint8_t> expected(MAX_RUN_LENGTH + 1, 0xAA);
+                    std::vector<uint8_t> actual = expected;
+                    blit_sample_scalar(width, zoom, &_src[alignment], expected.data());
+                    fn(width, zoom, &_src[alignment], actual.data());
+                    ASSERT_EQ(expected, actual) << "zoom " << zoom << ", width " << width << ", alignment " << alignment;
+                }
+            }
+        }
+    }
+
+    void CheckRemap(BlitRemapFunction scalarFn, BlitRemapFunction fn)
+    {
+        for (int32_t alignment = 0; alignment < MAX_ALIGNMENT; alignment++)
+        {
+            for (int32_t width = 0; width <= MAX_RUN_LENGTH; width++)
+            {
+                std::vector<uint8_t> expected = _dst;
+                std::vector<uint8_t> actual = _dst;
+                scalarFn(width, &_src[alignment], &expected[alignment], _palette.data());
+                fn(width, &_src[alignment], &actual[alignment], _palette.data());
+                ASSERT_EQ(expected, actual) << "width " << width << ", alignment " << alignment;
+            }
+        }
+    }
+
+    void CheckRemapInPlace(BlitRemapFunction fn)
+    {
+        for (int32_t alignment = 0; alignment < MAX_ALIGNMENT; alignment++)
+        {
+            for (int32_t width = 0; width <= MAX_RUN_LENGTH; width++)
+            {
+                std::vector<uint8_t> expected = _dst;
+                std::vector<uint8_t> actual = _dst;
+                blit_remap_scalar(width, &expected[alignment], &expected[alignment], _palette.data());
+                fn(width, &actual[alignment], &actual[alignment], _palette.data());
+                ASSERT_EQ(expected, actual) << "width " << width << ", alignment " << alignment;
+            }
+        }
+    }
+};
+
+TEST_F(BlitTests, transparent_sse4_1)
+{
+    if (sse41_available())
+    {
+        CheckTransparent(blit_transparent_sse4_1);
+    }
+}
+
+TEST_F(BlitTests, transparent_avx2)
+{
+    if (avx2_available())
+    {
+        CheckTransparent(blit_transparent_avx2);
+    }
+}
+
+TEST_F(BlitTests, sample_sse4_1)
+{
+    if (sse41_available())
+    {
+        CheckSample(blit_sample_sse4_1);
+    }
+}
+
+TEST_F(BlitTests, remap_avx2)
+{
+    if (avx2_available())
+    {
+        CheckRemap(blit_remap_scalar, blit_remap_avx2);
+        CheckRemapInPlace(blit_remap_avx2);
+    }
+}
+
+TEST_F(BlitTests, remap_blend_avx2)
+{
+    if (avx2_available())
+    {
+        CheckRemap(blit_remap_blend_scalar, blit_remap_blend_avx2);
+    }
+}
+
+TEST_F(BlitTests, registered_functions)
+{
+    blit_init();
+    CheckTransparent(blit_transparent_fn);
+    CheckSample(blit_sample_fn);
+    CheckRemap(blit_remap_scalar, blit_remap_fn);
+    CheckRemapInPlace(blit_remap_fn);
+    CheckRemap(blit_remap_blend_scalar, blit_remap_blend_fn);
+}
@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <climits>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/actions/StaffHireNewAction.hpp>
+#include <openrct2/actions/StaffSetNameAction.hpp>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/peep/Staff.h>
+#include <openrct2/platform/platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/Station.h>
+#include <openrct2/world/Sprite.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class StaffTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        core_init();
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string parkPath = TestData::GetParkPath("pathfinding-tests.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    static Ride* FindRideWithExit()
+    {
+        for (auto& ride : GetRideManager())
+        {
+            if (!ride_get_exit_location(&ride, ride.inspection_station).isNull())
+            {
+                return &ride;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Hires mechanics that are all waiting for an inspection at the exit of the ride, so that they are equally close.
+     */
+    static std::vector<uint16_t> HireMechanicsAtExit(Ride* ride, int32_t count)
+    {
+        auto exit = ride_get_exit_location(ride, ride->inspection_station);
+        std::vector<uint16_t> mechanics;
+        for (int32_t i = 0; i < count; i++)
+        {
+            auto hireStaffAction = StaffHireNewAction(
+                false, STAFF_TYPE_MECHANIC, ENTERTAINER_COSTUME_PANDA, STAFF_ORDERS_INSPECT_RIDES | STAFF_ORDERS_FIX_RIDES);
+            auto res = GameActions::Execute(&hireStaffAction);
+            EXPECT_EQ(GA_ERROR::OK, res->Error);
+            if (res->Error != GA_ERROR::OK)
+            {
+                break;
+            }
+
+            uint16_t spriteIndex = static_cast<const StaffHireNewActionResult*>(res.get())->peepSriteIndex;
+            Peep* mechanic = GET_PEEP(spriteIndex);
+            mechanic->state = PEEP_STATE_PATROLLING;
+            sprite_move(exit.x * 32 + 16, exit.y * 32 + 16, exit.z * 8, (rct_sprite*)mechanic);
+            mechanics.push_back(spriteIndex);
+        }
+        return mechanics;
+    }
+
+    /**
+     * The closest mechanic for an inspection as found by going through every peep, the first one wins a tie.
+     */
+    static Peep* FindClosestMechanicLinear(Ride* ride)
+    {
+        auto exit = ride_get_exit_location(ride, ride->inspection_station);
+        int32_t x = exit.x * 32 + 16;
+        int32_t y = exit.y * 32 + 16;
+
+        uint32_t closestDistance = UINT_MAX;
+        Peep* closestMechanic = nullptr;
+        uint16_t spriteIndex;
+        Peep* peep;
+        FOR_ALL_STAFF (spriteIndex, peep)
+        {
+            if (peep->staff_type != STAFF_TYPE_MECHANIC || peep->state != PEEP_STATE_PATROLLING
+                || !(peep->staff_orders & STAFF_ORDERS_INSPECT_RIDES) || peep->x == LOCATION_NULL)
+            {
+                continue;
+            }
+
+            uint32_t distance = std::abs(peep->x - x) + std::abs(peep->y - y);
+            if (distance < closestDistance)
+            {
+                closestDistance = distance;
+                closestMechanic = peep;
+            }
+        }
+        return closestMechanic;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> StaffTests::_context;
+
+TEST_F(StaffTests, closest_mechanic_follows_name_order)
+{
+    Ride* ride = FindRideWithExit();
+    ASSERT_NE(nullptr, ride);
+
+    auto mechanics = HireMechanicsAtExit(ride, 3);
+    ASSERT_EQ(3U, mechanics.size());
+    EXPECT_EQ(FindClosestMechanicLinear(ride), ride_find_closest_mechanic(ride, 1));
+
+    // Renaming moves the mechanics around in the peep list, which decides which one of them is chosen
+    for (auto name : { "Aaron", "Zack", "Abigail" })
+    {
+        for (auto spriteIndex : mechanics)
+        {
+            auto staffSetNameAction = StaffSetNameAction(spriteIndex, name);
+            auto res = GameActions::Execute(&staffSetNameAction);
+            ASSERT_EQ(GA_ERROR::OK, res->Error);
+
+            Peep* expected = FindClosestMechanicLinear(ride);
+            ASSERT_NE(nullptr, expected);
+            EXPECT_EQ(expected, ride_find_closest_mechanic(ride, 1)) << "after renaming sprite " << spriteIndex;
+
+            // Give the name back so that the next mechanic can take it
+            auto resetNameAction = StaffSetNameAction(spriteIndex, "Mechanic");
+            GameActions::Execute(&resetNameAction);
+        }
+    }
+
+    peep_sort();
+    EXPECT_EQ(FindClosestMechanicLinear(ride), ride_find_closest_mechanic(ride, 1));
+}
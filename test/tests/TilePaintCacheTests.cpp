@@ -0,0 +1,311 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/paint/TilePaintCache.h>
+#include <openrct2/paint/tile_element/Paint.TileElement.h>
+#include <openrct2/peep/Staff.h>
+#include <openrct2/platform/platform.h>
+#include <openrct2/sprites.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Sprite.h>
+#include <openrct2/world/TileElement.h>
+
+using namespace OpenRCT2;
+
+static uint32_t _animationFrame = 0;
+
+/**
+ * Paints each element the way the track and scenery painters do: a root paint struct with an attached image and
+ * children, going back to the root to add another child, and changing the paint struct after it was created.
+ */
+static bool paint_test_elements(paint_session* session, TileElement* firstElement)
+{
+    TileElement* element = firstElement;
+    do
+    {
+        session->CurrentlyDrawnItem = element;
+        int16_t height = element->base_height * 8;
+
+        paint_struct* root = sub_98197C(session, SPR_TEMP, 0, 0, 32, 32, 2, height, 0, 0, height);
+        if (root != nullptr)
+        {
+            root->flags |= PAINT_STRUCT_FLAG_IS_MASKED;
+            root->colour_image_id = SPR_TEMP;
+        }
+        paint_attach_to_previous_ps(session, SPR_TEMP, 4, 4);
+        sub_98199C(session, SPR_TEMP, 0, 0, 16, 16, 2, height, 8, 8, height + 8);
+        session->LastRootPS = root;
+        sub_98199C(session, SPR_TEMP, 0, 0, 8, 8, 2, height, 12, 12, height + 16);
+        paint_util_set_general_support_height(session, height + 16, 0x20);
+    } while (!(element++)->IsLastForTile());
+    return true;
+}
+
+/**
+ * Paints an animation frame, which changes without the elements changing.
+ */
+static bool paint_test_elements_animated(paint_session* session, TileElement* firstElement)
+{
+    paint_test_elements(session, firstElement);
+    tile_paint_cache_set_volatile(session);
+    sub_98199C(session, SPR_TEMP | (_animationFrame << 19), 0, 0, 4, 4, 2, 0, 14, 14, 32);
+    return true;
+}
+
+class TilePaintCacheTests : public testing::Test
+{
+protected:
+    static constexpr int32_t NUM_ELEMENTS = 3;
+
+    TileElement _elements[NUM_ELEMENTS];
+    std::unique_ptr<paint_session> _session = std::make_unique<paint_session>();
+
+    void SetUp() override
+    {
+        rct_g1_element g1 = {};
+        g1.width = 32;
+        g1.height = 32;
+        g1.x_offset = -16;
+        g1.y_offset = -16;
+        gfx_set_g1_element(SPR_TEMP, &g1);
+
+        for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+        {
+            _elements[i].ClearAs(TILE_ELEMENT_TYPE_SMALL_SCENERY);
+            _elements[i].base_height = 2 + i * 4;
+            _elements[i].clearance_height = 4 + i * 4;
+        }
+        _elements[NUM_ELEMENTS - 1].SetLastForTile(true);
+
+        gStaffDrawPatrolAreas = SPRITE_INDEX_NULL;
+        _animationFrame = 0;
+        tile_paint_cache_update();
+        tile_paint_cache_clear();
+    }
+
+    void TearDown() override
+    {
+        tile_paint_cache_clear();
+    }
+
+    /**
+     * Paints the tile after something else, either from its elements or through the cache. The same session is used
+     * every time so that the paint structs, and the pointers between them, can be compared as they are. The pointers
+     * in the returned copy point into that session.
+     */
+    std::unique_ptr<paint_session> Paint(TilePaintElementsFunction paintElements, bool cached)
+    {
+        return PaintTile(_elements, { 32 * 10, 32 * 12 }, paintElements, cached);
+    }
+
+    std::unique_ptr<paint_session> PaintTile(
+        TileElement* elements, CoordsXY mapPosition, TilePaintElementsFunction paintElements, bool cached)
+    {
+        std::memset(_session.get(), 0, sizeof(paint_session));
+        _session->DPI.x = -0x1000;
+        _session->DPI.y = -0x1000;
+        _session->DPI.width = 0x2000;
+        _session->DPI.height = 0x2000;
+        _session->EndOfPaintStructArray = &_session->PaintStructs[4000 - 1];
+        _session->NextFreePaintStruct = _session->PaintStructs;
+        _session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
+        _session->MapPosition = mapPosition;
+        _session->SpritePosition = _session->MapPosition;
+        _session->InteractionType = VIEWPORT_INTERACTION_ITEM_SCENERY;
+
+        sub_98197C(_session.get(), SPR_TEMP, 0, 0, 32, 32, 1, 0, 0, 0, 0);
+
+        // As set up by tile_element_paint_setup
+        paint_util_set_segment_support_height(_session.get(), SEGMENTS_ALL, 0xFFFF, 0);
+        paint_util_force_set_general_support_height(_session.get(), -1, 0);
+        _session->WaterHeight = 0xFFFF;
+        _session->LeftTunnels[0] = { 0xFF, 0xFF };
+        _session->RightTunnels[0] = { 0xFF, 0xFF };
+        _session->VerticalTunnelHeight = 0xFF;
+
+        if (cached)
+        {
+            tile_paint_cache_paint(_session.get(), elements, paintElements);
+        }
+        else
+        {
+            paintElements(_session.get(), elements);
+        }
+
+        auto result = std::make_unique<paint_session>();
+        std::memcpy(result.get(), _session.get(), sizeof(paint_session));
+        return result;
+    }
+
+    size_t GetPaintStructCount(const paint_session& painted) const
+    {
+        return painted.NextFreePaintStruct - _session->PaintStructs;
+    }
+
+    void ExpectSamePaint(const paint_session& expected, const paint_session& actual) const
+    {
+        size_t count = GetPaintStructCount(expected);
+        ASSERT_EQ(count, GetPaintStructCount(actual));
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(0, std::memcmp(&expected.PaintStructs[i], &actual.PaintStructs[i], sizeof(paint_entry)))
+                << "paint struct " << i;
+        }
+        EXPECT_EQ(expected.LastRootPS, actual.LastRootPS);
+        EXPECT_EQ(expected.UnkF1AD2C, actual.UnkF1AD2C);
+        EXPECT_EQ(expected.CurrentlyDrawnItem, actual.CurrentlyDrawnItem);
+        EXPECT_EQ(expected.InteractionType, actual.InteractionType);
+        EXPECT_EQ(expected.SpritePosition.x, actual.SpritePosition.x);
+        EXPECT_EQ(expected.SpritePosition.y, actual.SpritePosition.y);
+        EXPECT_EQ(expected.MapPosition.x, actual.MapPosition.x);
+        EXPECT_EQ(expected.MapPosition.y, actual.MapPosition.y);
+        EXPECT_EQ(expected.Support.height, actual.Support.height);
+        EXPECT_EQ(expected.Support.slope, actual.Support.slope);
+    }
+};
+
+TEST_F(TilePaintCacheTests, replayed_tile_matches_painted_tile)
+{
+    auto painted = Paint(paint_test_elements, false);
+    ASSERT_GT(GetPaintStructCount(*painted), 1U);
+
+    // The first time the tile is recorded, then it is replayed
+    auto recorded = Paint(paint_test_elements, true);
+    ExpectSamePaint(*painted, *recorded);
+    auto replayed = Paint(paint_test_elements, true);
+    ExpectSamePaint(*painted, *replayed);
+}
+
+TEST_F(TilePaintCacheTests, changed_tile_is_painted_again)
+{
+    Paint(paint_test_elements, true);
+    _elements[1].base_height += 2;
+
+    auto painted = Paint(paint_test_elements, false);
+    auto replayed = Paint(paint_test_elements, true);
+    ExpectSamePaint(*painted, *replayed);
+}
+
+TEST_F(TilePaintCacheTests, volatile_tile_is_painted_every_time)
+{
+    Paint(paint_test_elements_animated, true);
+    _animationFrame = 1;
+
+    auto painted = Paint(paint_test_elements_animated, false);
+    auto replayed = Paint(paint_test_elements_animated, true);
+    ExpectSamePaint(*painted, *replayed);
+}
+
+/**
+ * Paints tiles of a park with the game's own painters, which needs the base graphics for the bounding boxes.
+ */
+class TilePaintCacheParkTests : public TilePaintCacheTests
+{
+protected:
+    static void SetUpTestCase()
+    {
+        core_init();
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string parkPath = TestData::GetParkPath("pathfinding-tests.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    /**
+     * Finds the first tile that only has a surface and, if asked for, a path without additions on it.
+     */
+    static TileElement* FindTile(bool withPath, CoordsXY& mapPosition)
+    {
+        for (int32_t y = 1; y < gMapSize - 1; y++)
+        {
+            for (int32_t x = 1; x < gMapSize - 1; x++)
+            {
+                TileElement* firstElement = map_get_first_element_at(x, y);
+                if (firstElement == nullptr)
+                    continue;
+
+                bool hasPath = false;
+                bool onlySurfaceAndPath = true;
+                TileElement* element = firstElement;
+                do
+                {
+                    if (element->GetType() == TILE_ELEMENT_TYPE_PATH && !element->AsPath()->HasAddition())
+                    {
+                        hasPath = true;
+                    }
+                    else if (element->GetType() != TILE_ELEMENT_TYPE_SURFACE)
+                    {
+                        onlySurfaceAndPath = false;
+                    }
+                } while (!(element++)->IsLastForTile());
+
+                if (onlySurfaceAndPath && hasPath == withPath)
+                {
+                    mapPosition = { x * 32, y * 32 };
+                    return firstElement;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void ExpectReplayedTileMatchesPaintedTile(bool withPath)
+    {
+        CoordsXY mapPosition;
+        TileElement* elements = FindTile(withPath, mapPosition);
+        ASSERT_NE(nullptr, elements);
+
+        auto painted = PaintTile(elements, mapPosition, tile_element_paint_elements, false);
+        ASSERT_GT(GetPaintStructCount(*painted), 1U);
+
+        auto recorded = PaintTile(elements, mapPosition, tile_element_paint_elements, true);
+        ExpectSamePaint(*painted, *recorded);
+        auto replayed = PaintTile(elements, mapPosition, tile_element_paint_elements, true);
+        ExpectSamePaint(*painted, *replayed);
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> TilePaintCacheParkTests::_context;
+
+TEST_F(TilePaintCacheParkTests, replayed_surface_matches_painted_surface)
+{
+    ExpectReplayedTileMatchesPaintedTile(false);
+}
+
+TEST_F(TilePaintCacheParkTests, replayed_path_matches_painted_path)
+{
+    ExpectReplayedTileMatchesPaintedTile(true);
+}